@@ -30,10 +30,13 @@
 #include "mem_manager.h"
 #include "nrf_crypto_ecc.h"
 #include "libbtc/sha2.h"
+#include "libbtc/hash.h"
 #include "libbtc/ripemd160.h"
 #include "libbtc/base58.h"
 #include "libbtc/utils.h"
 #include "secp256k1/secp256k1.h"
+#include "secp256k1/secp256k1_recovery.h"
+#include "secp256k1/secp256k1_schnorrsig.h"
 
 #include "crypto.h"
 #include "otk.h"
@@ -59,6 +62,14 @@ do {                                                        \
 } while (0);
 
 
+#if CRYPTO_USE_NATIVE_ECDSA_VERIFY
+/* Verification key, public key decompressed for secp256k1. */
+typedef secp256k1_pubkey crypto_verifyKey;
+#else
+/* Verification key, public key imported to nrf_crypto. */
+typedef nrf_crypto_ecc_public_key_t crypto_verifyKey;
+#endif
+
 /* === Start of local functions declaration === */
 static void crypto_serialize32(
     uint32_t i,
@@ -72,14 +83,42 @@ static OTK_Return crypto_childKeyDerivation(
     CRYPTO_HDNode *derivehdNode_ptr,
     uint32_t      index);
 
-static void crypto_serializedExtPublicKey(
-    CRYPTO_HDNode *hdNode_ptr);
+static uint8_t crypto_deriveCacheLookup(
+    CRYPTO_HDNode         *masterhdNode_ptr,
+    CRYPTO_derivativePath *path_ptr,
+    CRYPTO_HDNode         *node_ptr);
 
-static void crypto_serializedWIFPrivateKey(
-    CRYPTO_HDNode *hdNode_ptr);
+static void crypto_deriveCacheStore(
+    CRYPTO_derivativePath *path_ptr,
+    uint8_t               level,
+    CRYPTO_HDNode         *node_ptr);
 
-static int crypto_calcBtcAddr(
-    CRYPTO_HDNode *hdNode_ptr);
+static OTK_Return crypto_importPublicKey(
+    CRYPTO_publicKey   *publicKey_ptr,
+    crypto_verifyKey   *verifyKey_ptr);
+
+static crypto_verifyKey *crypto_acquireVerifyKey(
+    CRYPTO_publicKey   *publicKey_ptr,
+    crypto_verifyKey   *localKey_ptr);
+
+static void crypto_releaseVerifyKey(
+    crypto_verifyKey   *verifyKey_ptr,
+    crypto_verifyKey   *localKey_ptr);
+
+static OTK_Return crypto_verifyWithKey(
+    crypto_verifyKey   *verifyKey_ptr,
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    CRYPTO_signature   *signature_ptr);
+
+static OTK_Return crypto_signSchnorrItems(
+    CRYPTO_privateKey  *privateKey_ptr,
+    CRYPTO_publicKey   *publicKey_ptr,
+    const uint8_t      *hashes_ptr,
+    size_t             count,
+    const uint8_t      *auxRand_ptr,
+    CRYPTO_signature   *signatures_ptr,
+    OTK_Return         *status_ptr);
 /* === End of local functions declaration === */
 
 
@@ -87,6 +126,43 @@ static int crypto_calcBtcAddr(
 static bool _initiated = false;                             /* wether crypto module has been initiated */
 static const char _hmac_sha512Key[] = "Bitcoin seed";
 static const uint8_t empty[CRYPTO_DECOMP_PUBLIC_KEY_SZ] = {0}; /* For comparing if a key is empty. */
+
+#if CRYPTO_DERIVE_CACHE_BUDGET > 0
+/* Derivation cache entry, only raw key material of an intermediate node is kept. */
+typedef struct {
+    uint8_t  level;                                         /* Levels below master, 0 means entry unused */
+    uint32_t lastUse;                                       /* LRU stamp */
+    uint32_t prefix[CRYPTO_DERIVATIVE_DEPTH];               /* Path indexes of level 0 ~ (level - 1) */
+    uint32_t fingerprint;
+    uint32_t childNum;
+    CRYPTO_chainCode  chainCode;
+    CRYPTO_privateKey privateKey;
+    CRYPTO_publicKey  publicKey;
+    CRYPTO_hash160    hash160;
+} crypto_deriveCacheEntry;
+
+#define CRYPTO_DERIVE_CACHE_ENTRIES ((int)(CRYPTO_DERIVE_CACHE_BUDGET / sizeof(crypto_deriveCacheEntry)))
+
+static crypto_deriveCacheEntry _deriveCache[CRYPTO_DERIVE_CACHE_ENTRIES];
+static CRYPTO_chainCode _deriveCacheMasterChainCode;        /* Identity of the master the cache belongs to */
+static CRYPTO_publicKey _deriveCacheMasterPublicKey;
+static uint32_t _deriveCacheClock = 0;
+static CRYPTO_chainCode _deriveHmacChainCode;               /* Parent chain code the HMAC midstates belong to */
+static HASH_HMAC_SHA512_CTX _deriveHmacCtx;
+static bool _deriveHmacPrepared = false;
+#endif /* CRYPTO_DERIVE_CACHE_BUDGET > 0 */
+
+#if CRYPTO_VERIFY_CACHE_ENTRIES > 0
+/* Verify cache entry, a public key already decompressed (and imported to nrf_crypto). */
+typedef struct {
+    uint32_t lastUse;                                       /* LRU stamp, 0 means entry unused */
+    CRYPTO_publicKey publicKey;
+    crypto_verifyKey verifyKey;
+} crypto_verifyCacheEntry;
+
+static crypto_verifyCacheEntry _verifyCache[CRYPTO_VERIFY_CACHE_ENTRIES];
+static uint32_t _verifyCacheClock = 0;
+#endif /* CRYPTO_VERIFY_CACHE_ENTRIES > 0 */
 /* === Start of local variables declaration === */
 
 
@@ -112,6 +188,24 @@ static OTK_Return crypto_derivePublicKeyFromPrivateKey(
     CRYPTO_HDNode *hdNode_ptr)
 {
     __INIT_CHECK__
+#if CRYPTO_USE_ECMULT_GEN_TABLE
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_pubkey pubKey;
+    size_t length = CRYPTO_PUBLIC_KEY_SZ;
+
+    if (1 != secp256k1_ec_pubkey_create(ctx_ptr, &pubKey, hdNode_ptr->privateKey.octets)) {
+        OTK_LOG_ERROR("secp256k1_ec_pubkey_create failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+
+    /* Serialize in compressed format. */
+    secp256k1_ec_pubkey_serialize(ctx_ptr, hdNode_ptr->publicKey.octets, &length, &pubKey, SECP256K1_EC_COMPRESSED);
+
+    /* Public key is set, keep its hash160 in sync. */
+    CRYPTO_refreshHash160(hdNode_ptr);
+
+    return (OTK_RETURN_OK);
+#else
     ret_code_t errCode;
     size_t length;
 
@@ -156,7 +250,11 @@ static OTK_Return crypto_derivePublicKeyFromPrivateKey(
     /* Append first 32 bytes of raw public key(uncompressed) to pubic key. */
     memcpy(hdNode_ptr->publicKey.octets + 1, pubKeyRaw, 32);
 
+    /* Public key is set, keep its hash160 in sync. */
+    CRYPTO_refreshHash160(hdNode_ptr);
+
     return (OTK_RETURN_OK);
+#endif
 }
 
 /*
@@ -177,7 +275,6 @@ OTK_Return crypto_childKeyDerivation(
 
     uint8_t I[CRYPTO_PRIVATE_KEY_SZ + CRYPTO_CHAIN_CODE_SZ] = {0};
     uint8_t data[1 + 32 + 4];
-    uint8_t fingerprint[32];
 
     /* Check if to derivate hardened child key, index > 2^31 - 1 */
     if (index & 0x80000000) {
@@ -206,15 +303,23 @@ OTK_Return crypto_childKeyDerivation(
     }
 
 
-    /* SHA256 */
-    sha256_Raw(masterhdNode_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ, fingerprint);
+    /* Fingerprint is the first 4 bytes of parent's hash160. */
+    derivehdNode_ptr->fingerprint = (masterhdNode_ptr->hash160.octets[0] << 24) +
+             (masterhdNode_ptr->hash160.octets[1] << 16) +
+             (masterhdNode_ptr->hash160.octets[2] << 8) + masterhdNode_ptr->hash160.octets[3];
 
-    ripemd160(fingerprint, SHA256_DIGEST_LENGTH, fingerprint);
-
-    derivehdNode_ptr->fingerprint = (fingerprint[0] << 24) + (fingerprint[1] << 16) +
-             (fingerprint[2] << 8) + fingerprint[3];
-
-    hmac_sha512(masterhdNode_ptr->chainCode.octets, CRYPTO_CHAIN_CODE_SZ, data, sizeof(data), I);
+#if CRYPTO_DERIVE_CACHE_BUDGET > 0
+    /* Siblings share parent's chain code, hash its HMAC key blocks once for all of them. */
+    if (!_deriveHmacPrepared ||
+            0 != memcmp(_deriveHmacChainCode.octets, masterhdNode_ptr->chainCode.octets, CRYPTO_CHAIN_CODE_SZ)) {
+        hash_hmac_sha512_Prepare(masterhdNode_ptr->chainCode.octets, CRYPTO_CHAIN_CODE_SZ, &_deriveHmacCtx);
+        memcpy(&_deriveHmacChainCode, &masterhdNode_ptr->chainCode, sizeof(CRYPTO_chainCode));
+        _deriveHmacPrepared = true;
+    }
+    hash_hmac_sha512_Prepared(&_deriveHmacCtx, data, sizeof(data), I);
+#else
+    hash_hmac_sha512(masterhdNode_ptr->chainCode.octets, CRYPTO_CHAIN_CODE_SZ, data, sizeof(data), I);
+#endif /* CRYPTO_DERIVE_CACHE_BUDGET > 0 */
 
     /* Copy first 32 bytes to private key. */
     memcpy(derivehdNode_ptr->privateKey.octets, I, CRYPTO_PRIVATE_KEY_SZ);
@@ -235,8 +340,213 @@ OTK_Return crypto_childKeyDerivation(
 }
 
 /*
- * ======== crypto_serializedHexPublicKey() ========
- * Serialize HD extended key.
+ * ======== crypto_deriveCacheLookup() ========
+ * Find the deepest cached node along given path of the master node.
+ * The cache is flushed if it was built for a different master node.
+ *
+ * Parameters:
+ *   node_ptr: filled with the cached node if found.
+ *
+ * Returns:
+ *   Number of levels below master the cached node is at, 0 if no prefix of the path is cached.
+ */
+static uint8_t crypto_deriveCacheLookup(
+    CRYPTO_HDNode         *masterhdNode_ptr,
+    CRYPTO_derivativePath *path_ptr,
+    CRYPTO_HDNode         *node_ptr)
+{
+#if CRYPTO_DERIVE_CACHE_BUDGET > 0
+    crypto_deriveCacheEntry *hit_ptr = NULL;
+    int i;
+
+    if ((0 != memcmp(_deriveCacheMasterChainCode.octets, masterhdNode_ptr->chainCode.octets, CRYPTO_CHAIN_CODE_SZ)) ||
+            (0 != memcmp(_deriveCacheMasterPublicKey.octets, masterhdNode_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ))) {
+        CRYPTO_clearDeriveCache();
+        memcpy(&_deriveCacheMasterChainCode, &masterhdNode_ptr->chainCode, sizeof(CRYPTO_chainCode));
+        memcpy(&_deriveCacheMasterPublicKey, &masterhdNode_ptr->publicKey, sizeof(CRYPTO_publicKey));
+        return (0);
+    }
+
+    for (i = 0; i < CRYPTO_DERIVE_CACHE_ENTRIES; i++) {
+        crypto_deriveCacheEntry *entry_ptr = &_deriveCache[i];
+
+        if ((0 == entry_ptr->level) || (NULL != hit_ptr && entry_ptr->level <= hit_ptr->level)) {
+            continue;
+        }
+        if (0 == memcmp(entry_ptr->prefix, path_ptr->derivativeIndex, entry_ptr->level * sizeof(uint32_t))) {
+            hit_ptr = entry_ptr;
+        }
+    }
+
+    if (NULL == hit_ptr) {
+        return (0);
+    }
+
+    hit_ptr->lastUse = ++_deriveCacheClock;
+    node_ptr->depth = masterhdNode_ptr->depth + hit_ptr->level;
+    node_ptr->fingerprint = hit_ptr->fingerprint;
+    node_ptr->childNum = hit_ptr->childNum;
+    memcpy(&node_ptr->chainCode, &hit_ptr->chainCode, sizeof(CRYPTO_chainCode));
+    memcpy(&node_ptr->privateKey, &hit_ptr->privateKey, sizeof(CRYPTO_privateKey));
+    memcpy(&node_ptr->publicKey, &hit_ptr->publicKey, sizeof(CRYPTO_publicKey));
+    memcpy(&node_ptr->hash160, &hit_ptr->hash160, sizeof(CRYPTO_hash160));
+
+    return (hit_ptr->level);
+#else
+    return (0);
+#endif /* CRYPTO_DERIVE_CACHE_BUDGET > 0 */
+}
+
+/*
+ * ======== crypto_deriveCacheStore() ========
+ * Store a derived node in the cache, evict the least recently used entry if the cache is full.
+ *
+ * Parameters:
+ *   level: number of levels below master the node is at.
+ *
+ * Returns:
+ */
+static void crypto_deriveCacheStore(
+    CRYPTO_derivativePath *path_ptr,
+    uint8_t               level,
+    CRYPTO_HDNode         *node_ptr)
+{
+#if CRYPTO_DERIVE_CACHE_BUDGET > 0
+    crypto_deriveCacheEntry *entry_ptr = &_deriveCache[0];
+    int i;
+
+    for (i = 0; i < CRYPTO_DERIVE_CACHE_ENTRIES; i++) {
+        if (0 == _deriveCache[i].level) {
+            entry_ptr = &_deriveCache[i];
+            break;
+        }
+        if (_deriveCache[i].lastUse < entry_ptr->lastUse) {
+            entry_ptr = &_deriveCache[i];
+        }
+    }
+
+    memset(entry_ptr, 0, sizeof(crypto_deriveCacheEntry));
+    entry_ptr->level = level;
+    entry_ptr->lastUse = ++_deriveCacheClock;
+    memcpy(entry_ptr->prefix, path_ptr->derivativeIndex, level * sizeof(uint32_t));
+    entry_ptr->fingerprint = node_ptr->fingerprint;
+    entry_ptr->childNum = node_ptr->childNum;
+    memcpy(&entry_ptr->chainCode, &node_ptr->chainCode, sizeof(CRYPTO_chainCode));
+    memcpy(&entry_ptr->privateKey, &node_ptr->privateKey, sizeof(CRYPTO_privateKey));
+    memcpy(&entry_ptr->publicKey, &node_ptr->publicKey, sizeof(CRYPTO_publicKey));
+    memcpy(&entry_ptr->hash160, &node_ptr->hash160, sizeof(CRYPTO_hash160));
+#endif /* CRYPTO_DERIVE_CACHE_BUDGET > 0 */
+}
+
+/*
+ * ======== crypto_importPublicKey() ========
+ * Decompress a public key, and convert it to nrf_crypto internal representation
+ * unless CRYPTO_USE_NATIVE_ECDSA_VERIFY.
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+static OTK_Return crypto_importPublicKey(
+    CRYPTO_publicKey   *publicKey_ptr,
+    crypto_verifyKey   *verifyKey_ptr)
+{
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+#if CRYPTO_USE_NATIVE_ECDSA_VERIFY
+
+    /* Decompress public key. */
+    if (1 != secp256k1_ec_pubkey_parse(ctx_ptr, verifyKey_ptr, publicKey_ptr->octets, CRYPTO_PUBLIC_KEY_SZ)) {
+        OTK_LOG_ERROR("Decompress public key failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+#else
+    CRYPTO_decompPublicKey decompPublicKey;
+    ret_code_t errCode = NRF_SUCCESS;
+
+    /* Decompress public key. */
+    if (1 != secp256k1_ec_pubkey_parse(
+            ctx_ptr, 
+            (secp256k1_pubkey *)decompPublicKey.octets, 
+            publicKey_ptr->octets, 
+            CRYPTO_PUBLIC_KEY_SZ)) {
+        OTK_LOG_ERROR("Decompress public key failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+
+    /* Converts raw public key to internal representation */
+    errCode = nrf_crypto_ecc_public_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
+           verifyKey_ptr, decompPublicKey.octets, CRYPTO_DECOMP_PUBLIC_KEY_SZ);
+    if (errCode != NRF_SUCCESS) {
+        OTK_LOG_ERROR("Error 0x%04X: %s", errCode, nrf_crypto_error_string_get(errCode));
+        return (OTK_RETURN_FAIL);
+    }
+#endif
+
+    return (OTK_RETURN_OK);
+}
+
+/*
+ * ======== CRYPTO_clearDeriveCache() ========
+ * Wipe all intermediate nodes and the HMAC key midstates kept by the derivation cache.
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+void CRYPTO_clearDeriveCache(void)
+{
+#if CRYPTO_DERIVE_CACHE_BUDGET > 0
+    memset(_deriveCache, 0, sizeof(_deriveCache));
+    memset(&_deriveCacheMasterChainCode, 0, sizeof(CRYPTO_chainCode));
+    memset(&_deriveCacheMasterPublicKey, 0, sizeof(CRYPTO_publicKey));
+    _deriveCacheClock = 0;
+    memset(&_deriveHmacChainCode, 0, sizeof(CRYPTO_chainCode));
+    memset(&_deriveHmacCtx, 0, sizeof(HASH_HMAC_SHA512_CTX));
+    _deriveHmacPrepared = false;
+#endif /* CRYPTO_DERIVE_CACHE_BUDGET > 0 */
+}
+
+/*
+ * ======== CRYPTO_refreshHash160() ========
+ * Recompute hash160 of HD node's public key. Nodes derived by CRYPTO have it set already,
+ * call it only when the public key is set by other means (e.g. converted from older key file).
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+void CRYPTO_refreshHash160(
+    CRYPTO_HDNode *node_ptr)
+{
+    uint8_t _sha256Result[SHA256_DIGEST_LENGTH];
+
+    hash_sha256_Raw(node_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ, _sha256Result);
+    ripemd160(_sha256Result, SHA256_DIGEST_LENGTH, node_ptr->hash160.octets);
+}
+
+/*
+ * ======== CRYPTO_encodeHexPublicKey() ========
+ * Encode HD node's compressed public key to hex string.
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+OTK_Return CRYPTO_encodeHexPublicKey(
+    CRYPTO_HDNode       *node_ptr,
+    CRYPTO_hexPublicKey *hexPublicKey_ptr)
+{
+    if (NULL == node_ptr || NULL == hexPublicKey_ptr) {
+        return (OTK_RETURN_FAIL);
+    }
+    utils_bin_to_hex(node_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ, hexPublicKey_ptr->str_ptr);
+
+    return (OTK_RETURN_OK);
+}
+
+/*
+ * ======== CRYPTO_encodeExtPublicKey() ========
+ * Serialize HD extended public key and encode it to base58check string.
  *
  * 4 byte: version bytes (mainnet: 0x0488B21E public, 0x0488ADE4 private; testnet: 0x043587CF public,
  *   0x04358394 private)
@@ -247,20 +557,16 @@ OTK_Return crypto_childKeyDerivation(
  * 32 bytes: the chain code
  * 33 bytes: the public key or private key data (serP(K) for public keys, 0x00 || ser256(k) for private keys)
  */
-void crypto_serializedExtPublicKey(
-    CRYPTO_HDNode *hdNode_ptr)
+OTK_Return CRYPTO_encodeExtPublicKey(
+    CRYPTO_HDNode       *node_ptr,
+    CRYPTO_extPublicKey *extPublicKey_ptr)
 {
-    memset(hdNode_ptr->extPublickey.str_ptr, 0, CRYPTO_EXT_PUBLIC_KEY_MAX_SZ);
+    if (NULL == node_ptr || NULL == extPublicKey_ptr) {
+        return (OTK_RETURN_FAIL);
+    }
+    memset(extPublicKey_ptr->str_ptr, 0, CRYPTO_EXT_PUBLIC_KEY_MAX_SZ);
 
-    char    *dest_ptr = hdNode_ptr->extPublickey.str_ptr;
-    size_t   destLen  = CRYPTO_EXT_PUBLIC_KEY_MAX_SZ;
     uint32_t version = 0x0488B21E;
-    uint8_t depth = hdNode_ptr->depth;
-    uint32_t fingerprint = hdNode_ptr->fingerprint;
-    uint32_t childNum = hdNode_ptr->childNum;
-    uint8_t *chainCode_ptr = hdNode_ptr->chainCode.octets;
-    uint8_t *key_ptr = hdNode_ptr->publicKey.octets;
-    bool     isPublicKey = true;
     uint8_t nodeData[78];
     uint8_t *cur_ptr = nodeData;
 
@@ -269,68 +575,78 @@ void crypto_serializedExtPublicKey(
 #endif
     crypto_serialize32(version, cur_ptr);
     cur_ptr += 4;
-    *cur_ptr = depth;
+    *cur_ptr = node_ptr->depth;
     cur_ptr += 1;
-    crypto_serialize32(fingerprint, cur_ptr);
+    crypto_serialize32(node_ptr->fingerprint, cur_ptr);
     cur_ptr += 4;
-    crypto_serialize32(childNum, cur_ptr);
+    crypto_serialize32(node_ptr->childNum, cur_ptr);
     cur_ptr += 4;
-    memcpy(cur_ptr, chainCode_ptr, CRYPTO_CHAIN_CODE_SZ);
+    memcpy(cur_ptr, node_ptr->chainCode.octets, CRYPTO_CHAIN_CODE_SZ);
     cur_ptr += CRYPTO_CHAIN_CODE_SZ;
-    if (isPublicKey) {
-        memcpy(cur_ptr, key_ptr, CRYPTO_PUBLIC_KEY_SZ);
-    } else {
-        *cur_ptr = 0;
-        cur_ptr += 1;
-        memcpy(cur_ptr, key_ptr, CRYPTO_PRIVATE_KEY_SZ);
+    memcpy(cur_ptr, node_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ);
+
+    if (0 == base58_encode_check(nodeData, sizeof(nodeData), extPublicKey_ptr->str_ptr, CRYPTO_EXT_PUBLIC_KEY_MAX_SZ)) {
+        return (OTK_RETURN_FAIL);
     }
-   
-    base58_encode_check(nodeData, 78, dest_ptr, destLen);
+    return (OTK_RETURN_OK);
 }
 
 /*
- * ======== crypto_serializedWIFPrivateKey() ========
- * Serialize HD node's private key to WIF formate string.
+ * ======== CRYPTO_encodeWIFPrivateKey() ========
+ * Encode HD node's private key to WIF format string.
  *
  */
-void crypto_serializedWIFPrivateKey(
-    CRYPTO_HDNode *hdNode_ptr)
+OTK_Return CRYPTO_encodeWIFPrivateKey(
+    CRYPTO_HDNode        *node_ptr,
+    CRYPTO_WIFPrivateKey *WIFPrivateKey_ptr)
 {
-    memset(hdNode_ptr->WIFPrivatekey.str_ptr, 0, CRYPTO_WIF_PRIVATE_KEY_SZ);
-
-    char    *dest_ptr = hdNode_ptr->WIFPrivatekey.str_ptr;
+    int ret;
     uint8_t extKey[CRYPTO_PRIVATE_KEY_SZ + 2];
 
+    if (NULL == node_ptr || NULL == WIFPrivateKey_ptr) {
+        return (OTK_RETURN_FAIL);
+    }
+    memset(WIFPrivateKey_ptr->str_ptr, 0, CRYPTO_WIF_PRIVATE_KEY_SZ);
+
     extKey[0] = 0x80;
-    memcpy(extKey + 1, hdNode_ptr->privateKey.octets, CRYPTO_PRIVATE_KEY_SZ);
+    memcpy(extKey + 1, node_ptr->privateKey.octets, CRYPTO_PRIVATE_KEY_SZ);
     extKey[CRYPTO_PRIVATE_KEY_SZ + 1] = 0x01;
  
-    base58_encode_check(extKey, CRYPTO_PRIVATE_KEY_SZ + 2, dest_ptr, CRYPTO_WIF_PRIVATE_KEY_SZ);
+    ret = base58_encode_check(extKey, sizeof(extKey), WIFPrivateKey_ptr->str_ptr, CRYPTO_WIF_PRIVATE_KEY_SZ);
+    memset(extKey, 0, sizeof(extKey));
+
+    return (0 == ret ? OTK_RETURN_FAIL : OTK_RETURN_OK);
 }
 
 /*
- * ======== crypto_calcBtcAddr() ========
- * Convert compressed public key to Bitcoin address
+ * ======== CRYPTO_encodeBtcAddr() ========
+ * Convert HD node's compressed public key to Bitcoin address
  *
- * Parameters: com
+ * Parameters:
  *
  * Returns:
  */
-static int crypto_calcBtcAddr(
-    CRYPTO_HDNode *hdNode_ptr)
+OTK_Return CRYPTO_encodeBtcAddr(
+    CRYPTO_HDNode  *node_ptr,
+    CRYPTO_btcAddr *btcAddr_ptr)
 {
-    __INIT_CHECK__
-    uint8_t _sha256Result[SHA256_DIGEST_LENGTH];
-    sha256_Raw(hdNode_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ, _sha256Result);
+    uint8_t _addressBase[1 + CRYPTO_HASH160_SZ];
+
+    if (NULL == node_ptr || NULL == btcAddr_ptr) {
+        return (OTK_RETURN_FAIL);
+    }
+    memset(btcAddr_ptr->str_ptr, 0, CRYPTO_BITCOIN_ADDR_SZ);
 
-    uint8_t _addressBase[21];
     memset(_addressBase, 0, sizeof(_addressBase));
 #if defined(TESTNET)
     _addressBase[0] = 0x6f;
 #endif
-    ripemd160(_sha256Result, SHA256_DIGEST_LENGTH, _addressBase + 1);
+    memcpy(_addressBase + 1, node_ptr->hash160.octets, CRYPTO_HASH160_SZ);
 
-    return base58_encode_check(_addressBase, 21, hdNode_ptr->btcAddr.str_ptr, CRYPTO_BITCOIN_ADDR_SZ);
+    if (0 == base58_encode_check(_addressBase, sizeof(_addressBase), btcAddr_ptr->str_ptr, CRYPTO_BITCOIN_ADDR_SZ)) {
+        return (OTK_RETURN_FAIL);
+    }
+    return (OTK_RETURN_OK);
 }
 
 uint32_t CRYPTO_rng32(void)
@@ -488,7 +804,7 @@ OTK_Return CRYPTO_deriveHdNode(
 #endif /* CRYPTO_DEBUG_INFO */
 
             /* Seed is not presented, generate a master node with given seed */
-            hmac_sha512((const uint8_t *)_hmac_sha512Key, strlen(_hmac_sha512Key), _ptrSeed->octets, CRYPTO_SEED_SIZE_OCTET, I);
+            hash_hmac_sha512((const uint8_t *)_hmac_sha512Key, strlen(_hmac_sha512Key), _ptrSeed->octets, CRYPTO_SEED_SIZE_OCTET, I);
 
             memcpy(derivehdNode_ptr->privateKey.octets, I, CRYPTO_PRIVATE_KEY_SZ);
             memcpy(derivehdNode_ptr->chainCode.octets, I + CRYPTO_PRIVATE_KEY_SZ, CRYPTO_CHAIN_CODE_SZ);
@@ -528,20 +844,24 @@ OTK_Return CRYPTO_deriveHdNode(
                 }
 
                 CRYPTO_HDNode _masterNode;
+                uint8_t level;
+
                 memcpy(&_masterNode, masterhdNode_ptr, sizeof(CRYPTO_HDNode));
-                for (int i = 0; i < CRYPTO_DERIVATIVE_DEPTH; i++) {
-                    crypto_childKeyDerivation(&_masterNode, derivehdNode_ptr, _prtPath->derivativeIndex[i]);
+                /* Resume from the deepest cached prefix of the path, only re-derive the differing levels. */
+                level = crypto_deriveCacheLookup(masterhdNode_ptr, _prtPath, &_masterNode);
+                memcpy(derivehdNode_ptr, &_masterNode, sizeof(CRYPTO_HDNode));
+                for (int i = level; i < CRYPTO_DERIVATIVE_DEPTH; i++) {
+                    if (OTK_RETURN_OK != crypto_childKeyDerivation(&_masterNode, derivehdNode_ptr, _prtPath->derivativeIndex[i])) {
+                        OTK_LOG_ERROR("Derive child key at level %d failed!!", i + 1);
+                        return (OTK_RETURN_FAIL);
+                    }
+                    crypto_deriveCacheStore(_prtPath, i + 1, derivehdNode_ptr);
                     memcpy(&_masterNode, derivehdNode_ptr, sizeof(CRYPTO_HDNode));
                 }
             }
         }
     }
 
-    utils_bin_to_hex(derivehdNode_ptr->publicKey.octets, CRYPTO_PUBLIC_KEY_SZ, derivehdNode_ptr->hexPublickey.str_ptr);
-    crypto_serializedExtPublicKey(derivehdNode_ptr);
-    crypto_serializedWIFPrivateKey(derivehdNode_ptr);
-    crypto_calcBtcAddr(derivehdNode_ptr);
-
 #if CRYPTO_DEBUG_INFO
     CRYPTO_dumpHDNode(derivehdNode_ptr);
 #endif
@@ -553,6 +873,8 @@ OTK_Return CRYPTO_deriveHdNode(
  * Sign a hash using given private key.
  *
  * Parameters:
+ *      recId_ptr       Recovery id (0 ~ 3) of the signature for CRYPTO_recover, can be NULL.
+ *                      Only available with CRYPTO_USE_NATIVE_ECDSA_SIGN.
  *
  * Returns:
  */
@@ -560,9 +882,41 @@ OTK_Return CRYPTO_sign(
     CRYPTO_privateKey  *privateKey_ptr,
     const uint8_t *hash_ptr,
     size_t         hashLen,
-    CRYPTO_signature      *signature_ptr)
+    CRYPTO_signature      *signature_ptr,
+    uint8_t               *recId_ptr)
 {
     __INIT_CHECK__
+#if CRYPTO_USE_NATIVE_ECDSA_SIGN
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_ecdsa_recoverable_signature signature;
+    int recId;
+
+#if CRYPTO_DEBUG_INFO
+    NRF_LOG_INFO("HASH:");
+    OTK_LOG_HEXDUMP(hash_ptr, hashLen);
+#endif /* CRYPTO_DEBUG_INFO */
+    if (hashLen != CRYPTO_HASH_SZ) {
+        OTK_LOG_ERROR("Invalid hash length (%d)", hashLen);
+        return (OTK_RETURN_FAIL);
+    }
+
+    /* Deterministic nonce (RFC6979), s is normalized to lower half of the order. */
+    if (1 != secp256k1_ecdsa_sign_recoverable(ctx_ptr, &signature, hash_ptr, privateKey_ptr->octets, NULL, NULL)) {
+        OTK_LOG_ERROR("secp256k1_ecdsa_sign_recoverable failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+    secp256k1_ecdsa_recoverable_signature_serialize_compact(ctx_ptr, signature_ptr->octets, &recId, &signature);
+    if (recId_ptr != NULL) {
+        *recId_ptr = (uint8_t)recId;
+    }
+
+#if CRYPTO_DEBUG_INFO
+    NRF_LOG_INFO("Signature:");
+    OTK_LOG_HEXDUMP(signature_ptr->octets, CRYPTO_SIGNATURE_SZ);
+#endif /* CRYPTO_DEBUG_INFO */
+
+    return (OTK_RETURN_OK);
+#else
     nrf_crypto_ecdsa_secp256k1_signature_t signature;
     nrf_crypto_ecc_private_key_t priKeyInt;
     ret_code_t errCode = NRF_SUCCESS;
@@ -571,6 +925,10 @@ OTK_Return CRYPTO_sign(
     NRF_LOG_INFO("HASH:");
     OTK_LOG_HEXDUMP(hash_ptr, hashLen);
 #endif /* CRYPTO_DEBUG_INFO */    
+    if (recId_ptr != NULL) {
+        OTK_LOG_ERROR("Recovery id requires CRYPTO_USE_NATIVE_ECDSA_SIGN!!");
+        return (OTK_RETURN_FAIL);
+    }
     /* Converts raw private key to internal representation */
     errCode = nrf_crypto_ecc_private_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
            &priKeyInt, privateKey_ptr->octets, CRYPTO_PRIVATE_KEY_SZ);
@@ -606,61 +964,478 @@ OTK_Return CRYPTO_sign(
     memcpy(signature_ptr->octets, signature, CRYPTO_SIGNATURE_SZ);
 
     return (OTK_RETURN_OK);
+#endif
 }
 
 /*
- * ======== CRYPTO_verify() ========
- * Verify given signature which is signed by the correspoding private key with the public key
+ * ======== CRYPTO_signBatch() ========
+ * Sign a list of hashes with the same private key. Keys are imported once for the whole batch,
+ * each signature is verified with publicKey_ptr unless it is NULL.
  *
  * Parameters:
+ *      scheme          CRYPTO_SIG_SCHNORR signs with fresh auxiliary randomness for each item.
+ *                      CRYPTO_SIG_ECDSA_RECOVERABLE checks each item by recovering publicKey_ptr
+ *                      instead of verifying with it.
+ *      hashes_ptr      count hashes of CRYPTO_HASH_SZ bytes, back to back.
+ *      signatures_ptr  Array of count signatures, a failed item is zeroed.
+ *      recIds_ptr      Array of count recovery ids of ECDSA signatures, can be NULL unless
+ *                      scheme is CRYPTO_SIG_ECDSA_RECOVERABLE.
+ *      status_ptr      Array of count per-item results, can be NULL.
  *
  * Returns:
+ *      OTK_RETURN_OK if all items are signed (and verified).
  */
-OTK_Return CRYPTO_verify(
+OTK_Return CRYPTO_signBatch(
+    CRYPTO_sigScheme   scheme,
+    CRYPTO_privateKey  *privateKey_ptr,
     CRYPTO_publicKey   *publicKey_ptr,
-    const uint8_t *hash_ptr,
-    size_t         hashLen,
-    CRYPTO_signature      *signature_ptr)    
+    const uint8_t      *hashes_ptr,
+    size_t             count,
+    CRYPTO_signature   *signatures_ptr,
+    uint8_t            *recIds_ptr,
+    OTK_Return         *status_ptr)
 {
     __INIT_CHECK__
-    nrf_crypto_ecc_public_key_t pubKeyInt;
+    crypto_verifyKey localKey;
+    crypto_verifyKey *verifyKey_ptr = NULL;
+    CRYPTO_publicKey recoveredKey;
+    const uint8_t *hash_ptr;
+    OTK_Return ret = OTK_RETURN_OK;
+    OTK_Return itemRet;
+    size_t i;
+#if CRYPTO_USE_NATIVE_ECDSA_SIGN
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_ecdsa_recoverable_signature signature;
+    int recId;
+#else
     ret_code_t errCode = NRF_SUCCESS;
-    OTK_Return ret = OTK_RETURN_FAIL;
-    CRYPTO_decompPublicKey  decompressedPubKey;
+    nrf_crypto_ecc_private_key_t priKeyInt;
+    nrf_crypto_ecdsa_sign_context_t signContext;
+    size_t sigLen;
+#endif
 
-    /* Decompress public key. */
-    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
-    if (1 != secp256k1_ec_pubkey_parse(
-            ctx_ptr, 
-            (secp256k1_pubkey *)decompressedPubKey.octets, 
-            publicKey_ptr->octets, 
-            CRYPTO_PUBLIC_KEY_SZ)) {
-        OTK_LOG_ERROR("Decompress public key failed!!");
+    if (scheme == CRYPTO_SIG_SCHNORR) {
+        return (crypto_signSchnorrItems(privateKey_ptr, publicKey_ptr, hashes_ptr, count, NULL,
+                signatures_ptr, status_ptr));
+    }
+
+    if ((scheme == CRYPTO_SIG_ECDSA_RECOVERABLE) && (recIds_ptr == NULL)) {
+        OTK_LOG_ERROR("Recoverable signatures need recIds_ptr!!");
         return (OTK_RETURN_FAIL);
     }
 
-    /* Converts raw private key to internal representation */
-    errCode = nrf_crypto_ecc_public_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
-           &pubKeyInt, decompressedPubKey.octets, CRYPTO_DECOMP_PUBLIC_KEY_SZ);
+#if !CRYPTO_USE_NATIVE_ECDSA_SIGN
+    if (recIds_ptr != NULL) {
+        OTK_LOG_ERROR("Recovery id requires CRYPTO_USE_NATIVE_ECDSA_SIGN!!");
+        return (OTK_RETURN_FAIL);
+    }
+
+    /* Converts raw private key to internal representation, once for all items. */
+    errCode = nrf_crypto_ecc_private_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
+           &priKeyInt, privateKey_ptr->octets, CRYPTO_PRIVATE_KEY_SZ);
     if (errCode != NRF_SUCCESS) {
         OTK_LOG_ERROR("Error 0x%04X: %s", errCode, nrf_crypto_error_string_get(errCode));
         return (OTK_RETURN_FAIL);
     }
+#endif
 
-    /* Verify the signature using ECDSA and SHA-256. */
-    errCode = nrf_crypto_ecdsa_verify(NULL, &pubKeyInt, hash_ptr, hashLen, signature_ptr->octets, CRYPTO_SIGNATURE_SZ);
-    if (errCode == NRF_SUCCESS) {
-        ret = OTK_RETURN_OK;
+    /* Recoverable signatures are checked by public key recovery, no verify key is needed. */
+    if ((publicKey_ptr != NULL) && (scheme != CRYPTO_SIG_ECDSA_RECOVERABLE) &&
+        (NULL == (verifyKey_ptr = crypto_acquireVerifyKey(publicKey_ptr, &localKey)))) {
+#if !CRYPTO_USE_NATIVE_ECDSA_SIGN
+        nrf_crypto_ecc_private_key_free(&priKeyInt);
+#endif
+        return (OTK_RETURN_FAIL);
+    }
+
+    for (i = 0; i < count; i++) {
+        hash_ptr = hashes_ptr + (i * CRYPTO_HASH_SZ);
+        itemRet = OTK_RETURN_FAIL;
+
+#if CRYPTO_USE_NATIVE_ECDSA_SIGN
+        if (1 == secp256k1_ecdsa_sign_recoverable(ctx_ptr, &signature, hash_ptr, privateKey_ptr->octets, NULL, NULL)) {
+            secp256k1_ecdsa_recoverable_signature_serialize_compact(ctx_ptr, signatures_ptr[i].octets, &recId, &signature);
+            if (recIds_ptr != NULL) {
+                recIds_ptr[i] = (uint8_t)recId;
+            }
+            itemRet = OTK_RETURN_OK;
+        }
+#else
+        sigLen = CRYPTO_SIGNATURE_SZ;
+        errCode = nrf_crypto_ecdsa_sign(&signContext, &priKeyInt, hash_ptr, CRYPTO_HASH_SZ,
+                signatures_ptr[i].octets, &sigLen);
+        if (errCode == NRF_SUCCESS) {
+            itemRet = OTK_RETURN_OK;
+        }
+#endif
+        if ((itemRet == OTK_RETURN_OK) && (publicKey_ptr != NULL) && (scheme == CRYPTO_SIG_ECDSA_RECOVERABLE)) {
+            /* Recovering the signer's key checks the signature and its recovery id at once. */
+            if ((OTK_RETURN_OK != CRYPTO_recover(hash_ptr, CRYPTO_HASH_SZ, &signatures_ptr[i], recIds_ptr[i], &recoveredKey)) ||
+                (0 != memcmp(&recoveredKey, publicKey_ptr, sizeof(CRYPTO_publicKey)))) {
+                itemRet = OTK_RETURN_FAIL;
+            }
+        }
+        else if ((itemRet == OTK_RETURN_OK) && (verifyKey_ptr != NULL)) {
+            itemRet = crypto_verifyWithKey(verifyKey_ptr, hash_ptr, CRYPTO_HASH_SZ, &signatures_ptr[i]);
+        }
+
+        if (itemRet != OTK_RETURN_OK) {
+            OTK_LOG_ERROR("Batch item %d failed!!", i);
+            memset(&signatures_ptr[i], 0, sizeof(CRYPTO_signature));
+            ret = OTK_RETURN_FAIL;
+        }
+        if (status_ptr != NULL) {
+            status_ptr[i] = itemRet;
+        }
     }
 
+    if (verifyKey_ptr != NULL) {
+        crypto_releaseVerifyKey(verifyKey_ptr, &localKey);
+    }
+#if !CRYPTO_USE_NATIVE_ECDSA_SIGN
+    nrf_crypto_ecc_private_key_free(&priKeyInt);
+#endif
+
+    return (ret);
+}
+
+/*
+ * ======== crypto_signSchnorrItems() ========
+ * Sign a list of hashes with BIP340 Schnorr. The key pair (and x-only verify key) is computed once
+ * for all items, each signature is verified with publicKey_ptr unless it is NULL.
+ *
+ * Parameters:
+ *      auxRand_ptr     Auxiliary randomness used for every item, fresh random bytes are drawn
+ *                      for each item if it is NULL.
+ *
+ * Returns:
+ *      OTK_RETURN_OK if all items are signed (and verified).
+ */
+static OTK_Return crypto_signSchnorrItems(
+    CRYPTO_privateKey  *privateKey_ptr,
+    CRYPTO_publicKey   *publicKey_ptr,
+    const uint8_t      *hashes_ptr,
+    size_t             count,
+    const uint8_t      *auxRand_ptr,
+    CRYPTO_signature   *signatures_ptr,
+    OTK_Return         *status_ptr)
+{
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_keypair keypair;
+    secp256k1_xonly_pubkey xonlyKey;
+    uint8_t auxRand[CRYPTO_HASH_SZ];
+    const uint8_t *hash_ptr;
+    OTK_Return ret = OTK_RETURN_OK;
+    OTK_Return itemRet;
+    size_t i;
+
+    if (1 != secp256k1_keypair_create(ctx_ptr, &keypair, privateKey_ptr->octets)) {
+        OTK_LOG_ERROR("secp256k1_keypair_create failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+    /* X-only key is the X coordinate, i.e. the compressed key without its parity byte. */
+    if ((publicKey_ptr != NULL) &&
+        (1 != secp256k1_xonly_pubkey_parse(ctx_ptr, &xonlyKey, publicKey_ptr->octets + 1))) {
+        OTK_LOG_ERROR("secp256k1_xonly_pubkey_parse failed!!");
+        memset(&keypair, 0, sizeof(keypair));
+        return (OTK_RETURN_FAIL);
+    }
+
+    for (i = 0; i < count; i++) {
+        hash_ptr = hashes_ptr + (i * CRYPTO_HASH_SZ);
+        itemRet = OTK_RETURN_FAIL;
+
+        if ((auxRand_ptr == NULL) &&
+            (NRF_SUCCESS != nrf_crypto_rng_vector_generate(auxRand, CRYPTO_HASH_SZ))) {
+            OTK_LOG_ERROR("Failed to generate auxiliary randomness.");
+        }
+        else if (1 == secp256k1_schnorrsig_sign(ctx_ptr, signatures_ptr[i].octets, hash_ptr, &keypair,
+                (auxRand_ptr != NULL) ? auxRand_ptr : auxRand)) {
+            itemRet = OTK_RETURN_OK;
+        }
+        if ((itemRet == OTK_RETURN_OK) && (publicKey_ptr != NULL) &&
+            (1 != secp256k1_schnorrsig_verify(ctx_ptr, signatures_ptr[i].octets, hash_ptr, &xonlyKey))) {
+            itemRet = OTK_RETURN_FAIL;
+        }
+
+        if (itemRet != OTK_RETURN_OK) {
+            OTK_LOG_ERROR("Schnorr item %d failed!!", i);
+            memset(&signatures_ptr[i], 0, sizeof(CRYPTO_signature));
+            ret = OTK_RETURN_FAIL;
+        }
+        if (status_ptr != NULL) {
+            status_ptr[i] = itemRet;
+        }
+    }
+    memset(&keypair, 0, sizeof(keypair));
+
+    return (ret);
+}
+
+/*
+ * ======== CRYPTO_signSchnorr() ========
+ * Sign a hash using given private key with BIP340 Schnorr signature.
+ *
+ * Parameters:
+ *      auxRand_ptr     CRYPTO_HASH_SZ bytes of auxiliary randomness, NULL to draw fresh random bytes.
+ *
+ * Returns:
+ */
+OTK_Return CRYPTO_signSchnorr(
+    CRYPTO_privateKey  *privateKey_ptr,
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    const uint8_t      *auxRand_ptr,
+    CRYPTO_signature   *signature_ptr)
+{
+    __INIT_CHECK__
+
+    if (hashLen != CRYPTO_HASH_SZ) {
+        OTK_LOG_ERROR("Invalid hash length (%d)", hashLen);
+        return (OTK_RETURN_FAIL);
+    }
+    return (crypto_signSchnorrItems(privateKey_ptr, NULL, hash_ptr, 1, auxRand_ptr, signature_ptr, NULL));
+}
+
+/*
+ * ======== crypto_acquireVerifyKey() ========
+ * Get verification key of a public key, from verify cache if enabled, otherwise imported into
+ * the given local key object.
+ *
+ * Parameters:
+ *
+ * Returns:
+ *      Pointer to the key object, NULL if public key is invalid.
+ */
+static crypto_verifyKey *crypto_acquireVerifyKey(
+    CRYPTO_publicKey   *publicKey_ptr,
+    crypto_verifyKey   *localKey_ptr)
+{
+#if CRYPTO_VERIFY_CACHE_ENTRIES > 0
+    crypto_verifyCacheEntry *entry_ptr = NULL;
+    int i;
+
+    (void)localKey_ptr;
+    for (i = 0; i < CRYPTO_VERIFY_CACHE_ENTRIES; i++) {
+        if ((_verifyCache[i].lastUse > 0) &&
+            (0 == memcmp(&_verifyCache[i].publicKey, publicKey_ptr, sizeof(CRYPTO_publicKey)))) {
+            entry_ptr = &_verifyCache[i];
+            break;
+        }
+    }
+
+    if (entry_ptr == NULL) {
+        /* Miss, replace the least recently used entry. */
+        entry_ptr = &_verifyCache[0];
+        for (i = 1; i < CRYPTO_VERIFY_CACHE_ENTRIES; i++) {
+            if (_verifyCache[i].lastUse < entry_ptr->lastUse) {
+                entry_ptr = &_verifyCache[i];
+            }
+        }
+        if (entry_ptr->lastUse > 0) {
+#if !CRYPTO_USE_NATIVE_ECDSA_VERIFY
+            nrf_crypto_ecc_public_key_free(&entry_ptr->verifyKey);
+#endif
+            entry_ptr->lastUse = 0;
+        }
+        if (OTK_RETURN_OK != crypto_importPublicKey(publicKey_ptr, &entry_ptr->verifyKey)) {
+            return (NULL);
+        }
+        memcpy(&entry_ptr->publicKey, publicKey_ptr, sizeof(CRYPTO_publicKey));
+    }
+    entry_ptr->lastUse = ++_verifyCacheClock;
+
+    return (&entry_ptr->verifyKey);
+#else
+    if (OTK_RETURN_OK != crypto_importPublicKey(publicKey_ptr, localKey_ptr)) {
+        return (NULL);
+    }
+    return (localKey_ptr);
+#endif /* CRYPTO_VERIFY_CACHE_ENTRIES > 0 */
+}
+
+/*
+ * ======== crypto_releaseVerifyKey() ========
+ * Release key object got from crypto_acquireVerifyKey(), only a locally imported nrf_crypto key is freed.
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+static void crypto_releaseVerifyKey(
+    crypto_verifyKey   *verifyKey_ptr,
+    crypto_verifyKey   *localKey_ptr)
+{
+#if CRYPTO_USE_NATIVE_ECDSA_VERIFY
+    /* Decompressed key holds no resource. */
+    (void)verifyKey_ptr;
+    (void)localKey_ptr;
+#else
+    ret_code_t errCode = NRF_SUCCESS;
+
+    if (verifyKey_ptr != localKey_ptr) {
+        return;
+    }
     /* Free key. */
-    errCode = nrf_crypto_ecc_public_key_free(&pubKeyInt);
+    errCode = nrf_crypto_ecc_public_key_free(localKey_ptr);
     if (errCode != NRF_SUCCESS) {
         OTK_LOG_ERROR("Error 0x%04X: %s", errCode, nrf_crypto_error_string_get(errCode));
     }
+#endif
+}
+
+/*
+ * ======== crypto_verifyWithKey() ========
+ * Verify an ECDSA signature with a key got from crypto_acquireVerifyKey().
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+static OTK_Return crypto_verifyWithKey(
+    crypto_verifyKey   *verifyKey_ptr,
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    CRYPTO_signature   *signature_ptr)
+{
+#if CRYPTO_USE_NATIVE_ECDSA_VERIFY
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_ecdsa_signature signature;
+
+    /* Like micro-ecc, both low and high S are accepted. */
+    if ((hashLen != CRYPTO_HASH_SZ) ||
+        (1 != secp256k1_ecdsa_signature_parse_compact(ctx_ptr, &signature, signature_ptr->octets))) {
+        return (OTK_RETURN_FAIL);
+    }
+
+    return ((1 == secp256k1_ecdsa_verify(ctx_ptr, &signature, hash_ptr, verifyKey_ptr)) ?
+            OTK_RETURN_OK : OTK_RETURN_FAIL);
+#else
+    ret_code_t errCode = NRF_SUCCESS;
+
+    /* Verify the signature using ECDSA and SHA-256. */
+    errCode = nrf_crypto_ecdsa_verify(NULL, verifyKey_ptr, hash_ptr, hashLen, signature_ptr->octets, CRYPTO_SIGNATURE_SZ);
+
+    return ((errCode == NRF_SUCCESS) ? OTK_RETURN_OK : OTK_RETURN_FAIL);
+#endif
+}
+
+/*
+ * ======== CRYPTO_verify() ========
+ * Verify given signature which is signed by the correspoding private key with the public key
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+OTK_Return CRYPTO_verify(
+    CRYPTO_publicKey   *publicKey_ptr,
+    const uint8_t *hash_ptr,
+    size_t         hashLen,
+    CRYPTO_signature      *signature_ptr)    
+{
+    __INIT_CHECK__
+    crypto_verifyKey localKey;
+    crypto_verifyKey *verifyKey_ptr;
+    OTK_Return ret;
+
+    if (NULL == (verifyKey_ptr = crypto_acquireVerifyKey(publicKey_ptr, &localKey))) {
+        return (OTK_RETURN_FAIL);
+    }
+
+    ret = crypto_verifyWithKey(verifyKey_ptr, hash_ptr, hashLen, signature_ptr);
+    crypto_releaseVerifyKey(verifyKey_ptr, &localKey);
+
     return (ret);
 }
 
+/*
+ * ======== CRYPTO_verifySchnorr() ========
+ * Verify given BIP340 Schnorr signature, only the X coordinate of the public key is used.
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+OTK_Return CRYPTO_verifySchnorr(
+    CRYPTO_publicKey   *publicKey_ptr,
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    CRYPTO_signature   *signature_ptr)
+{
+    __INIT_CHECK__
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_xonly_pubkey xonlyKey;
+
+    if ((hashLen != CRYPTO_HASH_SZ) ||
+        (1 != secp256k1_xonly_pubkey_parse(ctx_ptr, &xonlyKey, publicKey_ptr->octets + 1))) {
+        return (OTK_RETURN_FAIL);
+    }
+
+    return ((1 == secp256k1_schnorrsig_verify(ctx_ptr, signature_ptr->octets, hash_ptr, &xonlyKey)) ?
+            OTK_RETURN_OK : OTK_RETURN_FAIL);
+}
+
+/*
+ * ======== CRYPTO_recover() ========
+ * Recover compressed public key of the signer from an ECDSA signature and its recovery id.
+ *
+ * Parameters:
+ *
+ * Returns:
+ *      OTK_RETURN_OK if a public key is recovered, which also means the signature is valid for it.
+ */
+OTK_Return CRYPTO_recover(
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    CRYPTO_signature   *signature_ptr,
+    uint8_t            recId,
+    CRYPTO_publicKey   *publicKey_ptr)
+{
+    __INIT_CHECK__
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_ecdsa_recoverable_signature signature;
+    secp256k1_pubkey pubKey;
+    size_t length = CRYPTO_PUBLIC_KEY_SZ;
+
+    if ((hashLen != CRYPTO_HASH_SZ) ||
+        (1 != secp256k1_ecdsa_recoverable_signature_parse_compact(ctx_ptr, &signature, signature_ptr->octets, recId)) ||
+        (1 != secp256k1_ecdsa_recover(ctx_ptr, &pubKey, &signature, hash_ptr))) {
+        return (OTK_RETURN_FAIL);
+    }
+    secp256k1_ec_pubkey_serialize(ctx_ptr, publicKey_ptr->octets, &length, &pubKey, SECP256K1_EC_COMPRESSED);
+
+    return (OTK_RETURN_OK);
+}
+
+/*
+ * ======== CRYPTO_clearVerifyCache() ========
+ * Drop the verify cache entry of given public key, or all entries if publicKey_ptr is NULL.
+ *
+ * Parameters:
+ *
+ * Returns:
+ */
+void CRYPTO_clearVerifyCache(
+    CRYPTO_publicKey *publicKey_ptr)
+{
+#if CRYPTO_VERIFY_CACHE_ENTRIES > 0
+    int i;
+
+    for (i = 0; i < CRYPTO_VERIFY_CACHE_ENTRIES; i++) {
+        if ((_verifyCache[i].lastUse > 0) && ((publicKey_ptr == NULL) ||
+            (0 == memcmp(&_verifyCache[i].publicKey, publicKey_ptr, sizeof(CRYPTO_publicKey))))) {
+#if !CRYPTO_USE_NATIVE_ECDSA_VERIFY
+            nrf_crypto_ecc_public_key_free(&_verifyCache[i].verifyKey);
+#endif
+            memset(&_verifyCache[i], 0, sizeof(crypto_verifyCacheEntry));
+        }
+    }
+#else
+    (void)publicKey_ptr;
+#endif /* CRYPTO_VERIFY_CACHE_ENTRIES > 0 */
+}
+
 OTK_Return CRYPTO_init() 
 {
     ret_code_t errCode;
@@ -693,6 +1468,18 @@ OTK_Return CRYPTO_init()
         return (OTK_RETURN_FAIL);        
     }
 
+    /* Randomize blinding of secp256k1 generator multiplication, for public keys and signing nonces. */
+    uint8_t _seed[32];
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+
+    errCode = nrf_crypto_rng_vector_generate(_seed, sizeof(_seed));
+    APP_ERROR_CHECK(errCode);
+    if (NRF_SUCCESS != errCode || 1 != secp256k1_context_randomize(ctx_ptr, _seed)) {
+        OTK_LOG_ERROR("secp256k1_context_randomize failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+    memset(_seed, 0, sizeof(_seed));
+
     _initiated = true;
 
     return (OTK_RETURN_OK);
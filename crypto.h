@@ -33,6 +33,9 @@
 #define CRYPTO_PUBLIC_KEY_SZ            (33)    /* Compressed. */
 #define CRYPTO_DECOMP_PUBLIC_KEY_SZ     (64)    /* Uncompressed. */
 #define CRYPTO_SIGNATURE_SZ             (64)
+#define CRYPTO_RECOVERABLE_SIGNATURE_SZ (CRYPTO_SIGNATURE_SZ + 1)  /* Header byte with recovery id, r, s */
+#define CRYPTO_HASH_SZ                  (32)    /* Size of message digest to be signed. */
+#define CRYPTO_HASH160_SZ               (20)    /* RIPEMD160(SHA256(x)) */
 #define CRYPTO_SIGNATURE_HEXSTR_SZ      (CRYPTO_SIGNATURE_SZ * 2 + 1)
 #define CRYPTO_BITCOIN_ADDR_SZ          (35)    /* Compressed. */
 #define CRYPTO_HEX_PUBLIC_KEY_SZ        (CRYPTO_PUBLIC_KEY_SZ * 2 + 1)
@@ -41,6 +44,47 @@
 #define CRYPTO_DERIVATIVE_DEPTH         (5)
 #define CRYPTO_DERIVATIVE_PATH_STR_SZ   (CRYPTO_DERIVATIVE_DEPTH * 11)
 
+/* 
+ * RAM budget (in bytes) of the derivation cache which keeps intermediate nodes keyed by path prefix,
+ * so that a path change only re-derives from the first differing level. Define to 0 to disable.
+ */
+#ifndef CRYPTO_DERIVE_CACHE_BUDGET
+#define CRYPTO_DERIVE_CACHE_BUDGET      (1024)
+#endif
+
+/*
+ * Compute public keys with the fixed-base comb table of secp256k1 (secp256k1/ecmult_static_context.h,
+ * 64KB in flash) instead of the generic micro-ecc scalar multiplication. Define to 0 to fall back,
+ * the table stays in flash for secp256k1 signing.
+ */
+#ifndef CRYPTO_USE_ECMULT_GEN_TABLE
+#define CRYPTO_USE_ECMULT_GEN_TABLE     (1)
+#endif
+
+/*
+ * Sign with the constant-time ECDSA of secp256k1 (RFC6979 nonce, low-S) instead of micro-ecc.
+ * Define to 0 to fall back.
+ */
+#ifndef CRYPTO_USE_NATIVE_ECDSA_SIGN
+#define CRYPTO_USE_NATIVE_ECDSA_SIGN    (1)
+#endif
+
+/*
+ * Verify ECDSA with secp256k1 (Strauss-wNAF with the GLV endomorphism) instead of micro-ecc.
+ * Define to 0 to fall back.
+ */
+#ifndef CRYPTO_USE_NATIVE_ECDSA_VERIFY
+#define CRYPTO_USE_NATIVE_ECDSA_VERIFY  (1)
+#endif
+
+/*
+ * Number of public keys kept decompressed and imported for CRYPTO_verify, master and derivative by default.
+ * Define to 0 to disable.
+ */
+#ifndef CRYPTO_VERIFY_CACHE_ENTRIES
+#define CRYPTO_VERIFY_CACHE_ENTRIES     (2)
+#endif
+
 /* Seed struct. */
 typedef struct {
     uint8_t octets[CRYPTO_SEED_SIZE_OCTET];
@@ -71,11 +115,23 @@ typedef struct {
     uint8_t octets[CRYPTO_CHAIN_CODE_SZ];
 } CRYPTO_chainCode;
 
+/* Hash160 of public key struct. */
+typedef struct {
+    uint8_t octets[CRYPTO_HASH160_SZ];
+} CRYPTO_hash160;
+
 /* Signature struct. */
 typedef struct {
     uint8_t octets[CRYPTO_SIGNATURE_SZ];
 } CRYPTO_signature;
 
+/* Signature scheme, all give CRYPTO_SIGNATURE_SZ bytes. */
+typedef enum {
+    CRYPTO_SIG_ECDSA = 0,           /* ECDSA r || s, verified with CRYPTO_verify */
+    CRYPTO_SIG_SCHNORR,             /* BIP340 Schnorr R.x || s, verified with CRYPTO_verifySchnorr */
+    CRYPTO_SIG_ECDSA_RECOVERABLE,   /* ECDSA r || s and recovery id, checked with CRYPTO_recover */
+} CRYPTO_sigScheme;
+
 /* Extended public key string struct. */
 typedef struct {
     char  str_ptr[CRYPTO_EXT_PUBLIC_KEY_MAX_SZ];
@@ -104,10 +160,7 @@ typedef struct {
     CRYPTO_chainCode     chainCode;
     CRYPTO_privateKey    privateKey;
     CRYPTO_publicKey     publicKey;
-    CRYPTO_extPublicKey  extPublickey;
-    CRYPTO_hexPublicKey  hexPublickey; 
-    CRYPTO_WIFPrivateKey WIFPrivatekey; 
-    CRYPTO_btcAddr       btcAddr; 
+    CRYPTO_hash160       hash160;       /* Hash160 of publicKey, shared by child fingerprint and address */
 } CRYPTO_HDNode;
 
 uint32_t CRYPTO_rng32(void);
@@ -135,11 +188,53 @@ OTK_Return CRYPTO_deriveHdNode(
     CRYPTO_derivativePath   *path_ptr,
     CRYPTO_seed             *seed_ptr);
 
+void CRYPTO_clearDeriveCache(void);
+
+void CRYPTO_refreshHash160(
+    CRYPTO_HDNode *node_ptr);
+
+void CRYPTO_clearVerifyCache(
+    CRYPTO_publicKey *publicKey_ptr);
+
+OTK_Return CRYPTO_encodeHexPublicKey(
+    CRYPTO_HDNode       *node_ptr,
+    CRYPTO_hexPublicKey *hexPublicKey_ptr);
+
+OTK_Return CRYPTO_encodeExtPublicKey(
+    CRYPTO_HDNode       *node_ptr,
+    CRYPTO_extPublicKey *extPublicKey_ptr);
+
+OTK_Return CRYPTO_encodeWIFPrivateKey(
+    CRYPTO_HDNode        *node_ptr,
+    CRYPTO_WIFPrivateKey *WIFPrivateKey_ptr);
+
+OTK_Return CRYPTO_encodeBtcAddr(
+    CRYPTO_HDNode  *node_ptr,
+    CRYPTO_btcAddr *btcAddr_ptr);
+
 OTK_Return CRYPTO_sign(
     CRYPTO_privateKey  *privateKey_ptr,
     const uint8_t *hash_ptr,
     size_t         hashLen,
-    CRYPTO_signature      *signature_ptr);
+    CRYPTO_signature      *signature_ptr,
+    uint8_t               *recId_ptr);
+
+OTK_Return CRYPTO_signSchnorr(
+    CRYPTO_privateKey  *privateKey_ptr,
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    const uint8_t      *auxRand_ptr,
+    CRYPTO_signature   *signature_ptr);
+
+OTK_Return CRYPTO_signBatch(
+    CRYPTO_sigScheme   scheme,
+    CRYPTO_privateKey  *privateKey_ptr,
+    CRYPTO_publicKey   *publicKey_ptr,
+    const uint8_t      *hashes_ptr,
+    size_t             count,
+    CRYPTO_signature   *signatures_ptr,
+    uint8_t            *recIds_ptr,
+    OTK_Return         *status_ptr);
 
 OTK_Return CRYPTO_verify(
     CRYPTO_publicKey   *publicKey_ptr,
@@ -147,6 +242,19 @@ OTK_Return CRYPTO_verify(
     size_t         hashLen,
     CRYPTO_signature      *signature_ptr);
 
+OTK_Return CRYPTO_verifySchnorr(
+    CRYPTO_publicKey   *publicKey_ptr,
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    CRYPTO_signature   *signature_ptr);
+
+OTK_Return CRYPTO_recover(
+    const uint8_t      *hash_ptr,
+    size_t             hashLen,
+    CRYPTO_signature   *signature_ptr,
+    uint8_t            recId,
+    CRYPTO_publicKey   *publicKey_ptr);
+
 OTK_Return CRYPTO_init(void);
 
 #endif
@@ -23,6 +23,7 @@
 #include "nrf_delay.h"
 #include "nrf_log.h"
 #include "libbtc/utils.h"
+#include "libbtc/strwriter.h"
 
 #include "key.h"
 #include "fps.h"
@@ -69,9 +70,95 @@ static uint8_t _fixSeed[][CRYPTO_SEED_SIZE_OCTET] = {
          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4}};
 #endif
 
+/* Flags of string representations encoded in key_encodedNode. */
+#define KEY_ENCODED_HEX_PUBLIC_KEY  (1 << 0)
+#define KEY_ENCODED_EXT_PUBLIC_KEY  (1 << 1)
+#define KEY_ENCODED_WIF_PRIVATE_KEY (1 << 2)
+#define KEY_ENCODED_BTC_ADDR        (1 << 3)
+
+/* String representations of a key node, encoded on first request. */
+typedef struct {
+    uint8_t              encoded;       /* KEY_ENCODED_* flags of valid fields */
+    CRYPTO_hexPublicKey  hexPublicKey;
+    CRYPTO_extPublicKey  extPublicKey;
+    CRYPTO_WIFPrivateKey WIFPrivateKey;
+    CRYPTO_btcAddr       btcAddr;
+} key_encodedNode;
+
+/* HD node layout of key file written by firmware keeping string representations in node. */
+typedef struct {
+    uint8_t depth;
+    uint32_t fingerprint;
+    uint32_t childNum;
+    CRYPTO_chainCode     chainCode;
+    CRYPTO_privateKey    privateKey;
+    CRYPTO_publicKey     publicKey;
+    CRYPTO_extPublicKey  extPublickey;
+    CRYPTO_hexPublicKey  hexPublickey; 
+    CRYPTO_WIFPrivateKey WIFPrivatekey; 
+    CRYPTO_btcAddr       btcAddr; 
+} key_legacyHDNode;
+
+/* Key file layout written by firmware keeping string representations in node. */
+typedef struct {
+    key_legacyHDNode        master;
+    key_legacyHDNode        derivative;
+    CRYPTO_derivativePath   path;
+    CRYPTO_signature        *signature_ptr;
+    uint32_t                pin;
+    uint8_t                 pin_auth_failures;
+    uint32_t                pin_retry_after;
+    char                    keyNote[KEY_NOTE_LENGTH + 1];
+} key_legacyObject;
+
+/* HD node layout of key file written before hash160 was kept in node. */
+typedef struct {
+    uint8_t depth;
+    uint32_t fingerprint;
+    uint32_t childNum;
+    CRYPTO_chainCode     chainCode;
+    CRYPTO_privateKey    privateKey;
+    CRYPTO_publicKey     publicKey;
+} key_rawHDNode;
+
+/* Key file layout written before hash160 was kept in node. */
+typedef struct {
+    key_rawHDNode           master;
+    key_rawHDNode           derivative;
+    CRYPTO_derivativePath   path;
+    CRYPTO_signature        *signature_ptr;
+    uint32_t                pin;
+    uint8_t                 pin_auth_failures;
+    uint32_t                pin_retry_after;
+    char                    keyNote[KEY_NOTE_LENGTH + 1];
+} key_rawObject;
+
+/* Key file layout written before derivative keys were kept in slots. */
+typedef struct {
+    CRYPTO_HDNode           master;
+    CRYPTO_HDNode           derivative;
+    CRYPTO_derivativePath   path;
+    CRYPTO_signature        *signature_ptr;
+    uint32_t                pin;
+    uint8_t                 pin_auth_failures;
+    uint32_t                pin_retry_after;
+    char                    keyNote[KEY_NOTE_LENGTH + 1];
+} key_singleObject;
+
+/* Buffer for loading key file, it has to hold any layout ever written. */
+typedef union {
+    KEY_Object          keyObj;
+    key_singleObject    singleObj;
+    key_legacyObject    legacyObj;
+    key_rawObject       rawObj;
+} key_fileBuffer;
+
 static KEY_Object _keyObj;
+static uint8_t _keySlot = 0;    /* Selected slot, not saved, every boot starts with slot 0 */
+static key_encodedNode _encodedMaster;
+static key_encodedNode _encodedSlots[KEY_SLOT_COUNT];
 static CRYPTO_signature _signature;
-static char _keyDerivativePath[11 * CRYPTO_DERIVATIVE_DEPTH + 1];
+static char _keyDerivativePath[1 + 11 * CRYPTO_DERIVATIVE_DEPTH + 1];   /* "m" and "/<index>" of each level */
 static char _hexSignature[2 * CRYPTO_SIGNATURE_SZ + 1];
 
 static OTK_Return key_updateFile()
@@ -86,28 +173,177 @@ static OTK_Return key_updateFile()
     return (OTK_RETURN_OK);    
 }
 
-static void key_dumpKey(CRYPTO_HDNode node) 
+/* Slot of derivative key. */
+static KEY_Slot *key_slot(void)
+{
+    return (&_keyObj.slots[_keySlot]);
+}
+
+static CRYPTO_HDNode *key_node(bool isMaster)
 {
-    NRF_LOG_INFO("  Bitcoin Address: %s", node.btcAddr.str_ptr);
-    NRF_LOG_INFO("  Public Key: %s", node.hexPublickey.str_ptr);
-    NRF_LOG_INFO("  Extended Public Key: %s", node.extPublickey.str_ptr);
+    return (isMaster ? &_keyObj.master : &key_slot()->derivative);
+}
+
+static key_encodedNode *key_encodedNodeOf(bool isMaster)
+{
+    return (isMaster ? &_encodedMaster : &_encodedSlots[_keySlot]);
+}
+
+static void key_legacyNodeToNode(
+    key_legacyHDNode *legacyNode_ptr,
+    CRYPTO_HDNode    *node_ptr)
+{
+    node_ptr->depth = legacyNode_ptr->depth;
+    node_ptr->fingerprint = legacyNode_ptr->fingerprint;
+    node_ptr->childNum = legacyNode_ptr->childNum;
+    memcpy(&node_ptr->chainCode, &legacyNode_ptr->chainCode, sizeof(CRYPTO_chainCode));
+    memcpy(&node_ptr->privateKey, &legacyNode_ptr->privateKey, sizeof(CRYPTO_privateKey));
+    memcpy(&node_ptr->publicKey, &legacyNode_ptr->publicKey, sizeof(CRYPTO_publicKey));
+    CRYPTO_refreshHash160(node_ptr);
+}
+
+static void key_rawNodeToNode(
+    key_rawHDNode *rawNode_ptr,
+    CRYPTO_HDNode *node_ptr)
+{
+    node_ptr->depth = rawNode_ptr->depth;
+    node_ptr->fingerprint = rawNode_ptr->fingerprint;
+    node_ptr->childNum = rawNode_ptr->childNum;
+    memcpy(&node_ptr->chainCode, &rawNode_ptr->chainCode, sizeof(CRYPTO_chainCode));
+    memcpy(&node_ptr->privateKey, &rawNode_ptr->privateKey, sizeof(CRYPTO_privateKey));
+    memcpy(&node_ptr->publicKey, &rawNode_ptr->publicKey, sizeof(CRYPTO_publicKey));
+    CRYPTO_refreshHash160(node_ptr);
+}
+
+/*
+ * Restore key object from loaded key file, convert it if it was written in legacy layout.
+ * isLegacy_ptr is set if the file has to be rewritten in current layout.
+ */
+static OTK_Return key_restoreFromFile(
+    key_fileBuffer *file_ptr,
+    int            len,
+    bool           *isLegacy_ptr)
+{
+    *isLegacy_ptr = false;
+    memset(&_keyObj, 0, sizeof(_keyObj));
+
+    if (len == BYTES_TO_WORDS(sizeof(KEY_Object)) * sizeof(uint32_t)) {
+        memcpy(&_keyObj, &file_ptr->keyObj, sizeof(KEY_Object));
+    }
+    else if (len == BYTES_TO_WORDS(sizeof(key_singleObject)) * sizeof(uint32_t)) {
+        NRF_LOG_INFO("Converting key file to keep derivative keys in slots.");
+        memcpy(&_keyObj.master, &file_ptr->singleObj.master, sizeof(CRYPTO_HDNode));
+        memcpy(&_keyObj.slots[0].derivative, &file_ptr->singleObj.derivative, sizeof(CRYPTO_HDNode));
+        memcpy(&_keyObj.slots[0].path, &file_ptr->singleObj.path, sizeof(CRYPTO_derivativePath));
+        _keyObj.pin = file_ptr->singleObj.pin;
+        _keyObj.pin_auth_failures = file_ptr->singleObj.pin_auth_failures;
+        _keyObj.pin_retry_after = file_ptr->singleObj.pin_retry_after;
+        memcpy(_keyObj.keyNote, file_ptr->singleObj.keyNote, KEY_NOTE_LENGTH + 1);
+        *isLegacy_ptr = true;
+    }
+    else if (len == BYTES_TO_WORDS(sizeof(key_legacyObject)) * sizeof(uint32_t)) {
+        NRF_LOG_INFO("Converting key file from legacy layout.");
+        key_legacyNodeToNode(&file_ptr->legacyObj.master, &_keyObj.master);
+        key_legacyNodeToNode(&file_ptr->legacyObj.derivative, &_keyObj.slots[0].derivative);
+        memcpy(&_keyObj.slots[0].path, &file_ptr->legacyObj.path, sizeof(CRYPTO_derivativePath));
+        _keyObj.pin = file_ptr->legacyObj.pin;
+        _keyObj.pin_auth_failures = file_ptr->legacyObj.pin_auth_failures;
+        _keyObj.pin_retry_after = file_ptr->legacyObj.pin_retry_after;
+        memcpy(_keyObj.keyNote, file_ptr->legacyObj.keyNote, KEY_NOTE_LENGTH + 1);
+        *isLegacy_ptr = true;
+    }
+    else if (len == BYTES_TO_WORDS(sizeof(key_rawObject)) * sizeof(uint32_t)) {
+        NRF_LOG_INFO("Converting key file to keep hash160 in node.");
+        key_rawNodeToNode(&file_ptr->rawObj.master, &_keyObj.master);
+        key_rawNodeToNode(&file_ptr->rawObj.derivative, &_keyObj.slots[0].derivative);
+        memcpy(&_keyObj.slots[0].path, &file_ptr->rawObj.path, sizeof(CRYPTO_derivativePath));
+        _keyObj.pin = file_ptr->rawObj.pin;
+        _keyObj.pin_auth_failures = file_ptr->rawObj.pin_auth_failures;
+        _keyObj.pin_retry_after = file_ptr->rawObj.pin_retry_after;
+        memcpy(_keyObj.keyNote, file_ptr->rawObj.keyNote, KEY_NOTE_LENGTH + 1);
+        *isLegacy_ptr = true;
+    }
+    else {
+        OTK_LOG_ERROR("Unknown key file length (%d)!!", len);
+        return (OTK_RETURN_FAIL);
+    }
+    _keyObj.signature_ptr = NULL;
+
+    return (OTK_RETURN_OK);
+}
+
+/* Pick a random path for a slot and derive its child key from master key. */
+static OTK_Return key_initSlot(int slot)
+{
+    KEY_Slot *slot_ptr = &_keyObj.slots[slot];
+
+    /* XXX Here we derive a non-harden child node automatically for now. It should be requested by APP. */
+    CRYPTO_generateRandomPath(&slot_ptr->path);
+
+#if (defined DEBUG && defined FIX_SEED_INDEX)
+    /* Use index 0 for testing, slots differ in the last index. */
+    for (int i = 0; i < CRYPTO_DERIVATIVE_DEPTH; i++) {
+        CRYPTO_setDerivativePath(&slot_ptr->path, i, 0);
+    }
+    CRYPTO_setDerivativePath(&slot_ptr->path, CRYPTO_DERIVATIVE_DEPTH - 1, slot);
+#endif /* (defined DEBUG && defined FIX_SEED_INDEX) */
+
+    if (OTK_RETURN_OK != CRYPTO_deriveHdNode(&_keyObj.master, &slot_ptr->derivative, &slot_ptr->path, NULL)) {
+        OTK_LOG_ERROR("Failed to generate derivative node of slot %d!!", slot);
+        return (OTK_RETURN_FAIL);
+    }
+    return (OTK_RETURN_OK);
+}
+
+/* Drop encoded string representations of master or derivative key. */
+static void key_invalidateEncodedNode(bool isMaster)
+{
+    memset(key_encodedNodeOf(isMaster), 0, sizeof(key_encodedNode));
+}
+
+static void key_dumpKey(bool isMaster) 
+{
+    NRF_LOG_INFO("  Bitcoin Address: %s", KEY_getBtcAddr(isMaster));
+    NRF_LOG_INFO("  Public Key: %s", KEY_getHexPublicKey(isMaster));
+    NRF_LOG_INFO("  Extended Public Key: %s", KEY_getExtPublicKey(isMaster));
     nrf_delay_ms(5);
     NRF_LOG_INFO("\r\n");
 }
 
+OTK_Return KEY_selectSlot(uint32_t slot)
+{
+    if (slot >= KEY_SLOT_COUNT) {
+        OTK_LOG_ERROR("Invalid key slot (%lu)!!", slot);
+        return (OTK_RETURN_FAIL);
+    }
+    _keySlot = (uint8_t)slot;
+
+    return (OTK_RETURN_OK);
+}
+
+uint8_t KEY_getSlot()
+{
+    return (_keySlot);
+}
+
 CRYPTO_derivativePath *KEY_getDerivativePath() 
 {
-    return (&_keyObj.path);
+    return (&key_slot()->path);
 }
 
 char *KEY_getStrDerivativePath() 
 {
-    memset(_keyDerivativePath, 0, (11 * CRYPTO_DERIVATIVE_DEPTH));
+    STR_WRITER _writer;
     int i;
 
-    sprintf(_keyDerivativePath, "%s", "m");
+    strwriter_Init(&_writer, _keyDerivativePath, sizeof(_keyDerivativePath));
+    strwriter_Write(&_writer, "m", 1);
     for (i = 0; i < CRYPTO_DERIVATIVE_DEPTH; i++) {
-        sprintf(_keyDerivativePath, "%s/%lu", _keyDerivativePath, _keyObj.path.derivativeIndex[i]);
+        strwriter_Printf(&_writer, "/%lu", key_slot()->path.derivativeIndex[i]);
+    }
+    if (_writer.overflow) {
+        OTK_LOG_ERROR("Derivative path is too long!!");
+        return (NULL);
     }
 
     return (_keyDerivativePath);
@@ -116,7 +352,7 @@ char *KEY_getStrDerivativePath()
 void KEY_setNewDerivativePath(CRYPTO_derivativePath *derivativePath) 
 {
     for (int i = 0; i < CRYPTO_DERIVATIVE_DEPTH; i++) {
-        _keyObj.path.derivativeIndex[i] = derivativePath->derivativeIndex[i];
+        key_slot()->path.derivativeIndex[i] = derivativePath->derivativeIndex[i];
     }
 }
 
@@ -124,7 +360,10 @@ OTK_Return KEY_recalcDerivative()
 {
     OTK_Return ret = OTK_RETURN_FAIL;
 
-    ret = CRYPTO_deriveHdNode(&_keyObj.master, &_keyObj.derivative, &_keyObj.path, NULL);
+    /* Imported verify key of the old derivative is of no use anymore. */
+    CRYPTO_clearVerifyCache(&key_slot()->derivative.publicKey);
+    ret = CRYPTO_deriveHdNode(&_keyObj.master, &key_slot()->derivative, &key_slot()->path, NULL);
+    key_invalidateEncodedNode(false);
 
     if (ret != OTK_RETURN_OK) {
         OTK_LOG_ERROR("Failed to generate derivative node!!");
@@ -158,27 +397,72 @@ void KEY_eraseSignature()
 
 CRYPTO_publicKey *KEY_getPublicKey(bool getMaster) 
 {
-    return (getMaster ? &_keyObj.master.publicKey : &_keyObj.derivative.publicKey);
+    return (&key_node(getMaster)->publicKey);
+}
+
+CRYPTO_hash160 *KEY_getHash160(bool getMaster) 
+{
+    return (&key_node(getMaster)->hash160);
 }
 
 char *KEY_getHexPublicKey(bool getMaster) 
 {
-    return (getMaster ? _keyObj.master.hexPublickey.str_ptr : _keyObj.derivative.hexPublickey.str_ptr);
+    CRYPTO_HDNode   *node_ptr = key_node(getMaster);
+    key_encodedNode *enc_ptr  = key_encodedNodeOf(getMaster);
+
+    if (0 == (enc_ptr->encoded & KEY_ENCODED_HEX_PUBLIC_KEY)) {
+        if (OTK_RETURN_OK != CRYPTO_encodeHexPublicKey(node_ptr, &enc_ptr->hexPublicKey)) {
+            OTK_LOG_ERROR("Encode hex public key failed!!");
+            return (NULL);
+        }
+        enc_ptr->encoded |= KEY_ENCODED_HEX_PUBLIC_KEY;
+    }
+    return (enc_ptr->hexPublicKey.str_ptr);
 }
 
 char *KEY_getWIFPrivateKey(bool getMaster) 
 {
-    return (getMaster ? _keyObj.master.WIFPrivatekey.str_ptr : _keyObj.derivative.WIFPrivatekey.str_ptr);
+    CRYPTO_HDNode   *node_ptr = key_node(getMaster);
+    key_encodedNode *enc_ptr  = key_encodedNodeOf(getMaster);
+
+    if (0 == (enc_ptr->encoded & KEY_ENCODED_WIF_PRIVATE_KEY)) {
+        if (OTK_RETURN_OK != CRYPTO_encodeWIFPrivateKey(node_ptr, &enc_ptr->WIFPrivateKey)) {
+            OTK_LOG_ERROR("Encode WIF private key failed!!");
+            return (NULL);
+        }
+        enc_ptr->encoded |= KEY_ENCODED_WIF_PRIVATE_KEY;
+    }
+    return (enc_ptr->WIFPrivateKey.str_ptr);
 }
 
 char *KEY_getExtPublicKey(bool getMaster) 
 {
-    return (getMaster ? _keyObj.master.extPublickey.str_ptr : _keyObj.derivative.extPublickey.str_ptr);
+    CRYPTO_HDNode   *node_ptr = key_node(getMaster);
+    key_encodedNode *enc_ptr  = key_encodedNodeOf(getMaster);
+
+    if (0 == (enc_ptr->encoded & KEY_ENCODED_EXT_PUBLIC_KEY)) {
+        if (OTK_RETURN_OK != CRYPTO_encodeExtPublicKey(node_ptr, &enc_ptr->extPublicKey)) {
+            OTK_LOG_ERROR("Encode extended public key failed!!");
+            return (NULL);
+        }
+        enc_ptr->encoded |= KEY_ENCODED_EXT_PUBLIC_KEY;
+    }
+    return (enc_ptr->extPublicKey.str_ptr);
 }
 
 char *KEY_getBtcAddr(bool getMaster) 
 {
-    return (getMaster ? _keyObj.master.btcAddr.str_ptr : _keyObj.derivative.btcAddr.str_ptr);
+    CRYPTO_HDNode   *node_ptr = key_node(getMaster);
+    key_encodedNode *enc_ptr  = key_encodedNodeOf(getMaster);
+
+    if (0 == (enc_ptr->encoded & KEY_ENCODED_BTC_ADDR)) {
+        if (OTK_RETURN_OK != CRYPTO_encodeBtcAddr(node_ptr, &enc_ptr->btcAddr)) {
+            OTK_LOG_ERROR("Encode BTC address failed!!");
+            return (NULL);
+        }
+        enc_ptr->encoded |= KEY_ENCODED_BTC_ADDR;
+    }
+    return (enc_ptr->btcAddr.str_ptr);
 }
 
 uint32_t KEY_getPin()
@@ -199,17 +483,39 @@ OTK_Return KEY_init()
 
     /* Try to restore key object from saved file */
     int _len = 0;
-    if (FILE_load((uint8_t*)&_keyObj, &_len) == OTK_RETURN_OK) {
+    bool _isLegacy = false;
+    key_fileBuffer _fileBuf;
+
+    _keySlot = 0;
+    memset(&_encodedMaster, 0, sizeof(_encodedMaster));
+    memset(_encodedSlots, 0, sizeof(_encodedSlots));
+    CRYPTO_clearVerifyCache(NULL);
+    if (FILE_load((uint8_t*)&_fileBuf, &_len) == OTK_RETURN_OK) {
+        ret = key_restoreFromFile(&_fileBuf, _len, &_isLegacy);
+        memset(&_fileBuf, 0, sizeof(_fileBuf));
+        if (ret != OTK_RETURN_OK) {
+            return (OTK_RETURN_FAIL);        
+        }
         if (false == CRYPTO_isHDNodeValid(&(_keyObj.master))) {
             OTK_LOG_ERROR("Invalid master key.");
             CRYPTO_dumpHDNode(&_keyObj.master);
             nrf_delay_ms(5);
             return (OTK_RETURN_FAIL);        
         }
-        if (false == CRYPTO_isHDNodeValid(&(_keyObj.derivative))) {
-            OTK_LOG_ERROR("Invalid derivative key.");
-            CRYPTO_dumpHDNode(&_keyObj.derivative);
-            nrf_delay_ms(5);
+        for (int i = 0; i < KEY_SLOT_COUNT; i++) {
+            /* Files written before slots only have slot 0, derive keys for the others. */
+            if (_isLegacy && i > 0 && false == CRYPTO_isHDNodeValid(&(_keyObj.slots[i].derivative)) &&
+                    OTK_RETURN_OK != key_initSlot(i)) {
+                return (OTK_RETURN_FAIL);        
+            }
+            if (false == CRYPTO_isHDNodeValid(&(_keyObj.slots[i].derivative))) {
+                OTK_LOG_ERROR("Invalid derivative key of slot %d.", i);
+                CRYPTO_dumpHDNode(&_keyObj.slots[i].derivative);
+                nrf_delay_ms(5);
+                return (OTK_RETURN_FAIL);        
+            }
+        }
+        if (_isLegacy && key_updateFile() != OTK_RETURN_OK) {
             return (OTK_RETURN_FAIL);        
         }
     }           
@@ -241,21 +547,10 @@ OTK_Return KEY_init()
             return (OTK_RETURN_FAIL);        
         }
 
-        /* XXX Here we derive a non-harden child node automatically for now. It should be requested by APP. */
-        CRYPTO_generateRandomPath(&_keyObj.path);
-
-#if (defined DEBUG && defined FIX_SEED_INDEX)
-        /* Use index 0 for testing. */
-        for (int i = 0; i < CRYPTO_DERIVATIVE_DEPTH; i++) {
-            CRYPTO_setDerivativePath(&_keyObj.path, i, 0);
-        }
-#endif /* (defined DEBUG && defined FIX_SEED_INDEX) */
-
-        ret = CRYPTO_deriveHdNode(&_keyObj.master, &_keyObj.derivative, &_keyObj.path, NULL);
-
-        if (ret != OTK_RETURN_OK) {
-            OTK_LOG_ERROR("Failed to generate derivative node!!");
-            return (OTK_RETURN_FAIL);
+        for (int i = 0; i < KEY_SLOT_COUNT; i++) {
+            if (OTK_RETURN_OK != key_initSlot(i)) {
+                return (OTK_RETURN_FAIL);
+            }
         }
 
         _keyObj.pin = (KEY_DEFAULT_PIN);
@@ -274,9 +569,9 @@ OTK_Return KEY_init()
     NRF_LOG_INFO("pin_auth_failures: %d", _keyObj.pin_auth_failures);
     NRF_LOG_INFO("pin_retry_after: %d\n", _keyObj.pin_retry_after);
     NRF_LOG_INFO("Dupm Master Key:");
-    key_dumpKey(_keyObj.master);
+    key_dumpKey(true);
     NRF_LOG_INFO("Dupm Derivative Key:");
-    key_dumpKey(_keyObj.derivative);
+    key_dumpKey(false);
     NRF_LOG_INFO("Dupm Derivative Path: %s", KEY_getStrDerivativePath());
     NRF_LOG_INFO("\r\n");
    
@@ -293,16 +588,10 @@ OTK_Return KEY_sign(
     CRYPTO_publicKey  *_pubKey  = NULL;
     _keyObj.signature_ptr = NULL;        
 
-    if (usingMaster) {
-        _privKey = &_keyObj.master.privateKey;
-        _pubKey  = &_keyObj.master.publicKey;
-    }
-    else {
-        _privKey = &_keyObj.derivative.privateKey;
-        _pubKey  = &_keyObj.derivative.publicKey;
-    }
+    _privKey = &key_node(usingMaster)->privateKey;
+    _pubKey  = &key_node(usingMaster)->publicKey;
 
-    if (OTK_RETURN_OK != CRYPTO_sign(_privKey, hash_ptr, hashLen, &_signature)) {
+    if (OTK_RETURN_OK != CRYPTO_sign(_privKey, hash_ptr, hashLen, &_signature, NULL)) {
         OTK_LOG_ERROR("CRYPTO_sign failed!!");
         return (OTK_RETURN_FAIL);
     }
@@ -319,6 +608,28 @@ OTK_Return KEY_sign(
     return (OTK_RETURN_OK);
 }
 
+OTK_Return KEY_signBatch(
+    const uint8_t       *hashes_ptr,
+    size_t              count,
+    bool                usingMaster,
+    CRYPTO_sigScheme    scheme,
+    CRYPTO_signature    *signatures_ptr,
+    uint8_t             *recIds_ptr,
+    OTK_Return          *status_ptr
+    )
+{
+    CRYPTO_HDNode *_node = key_node(usingMaster);
+
+    /* Every signature is verified with the same public key, as KEY_sign does. */
+    if (OTK_RETURN_OK != CRYPTO_signBatch(scheme, &_node->privateKey, &_node->publicKey,
+            hashes_ptr, count, signatures_ptr, recIds_ptr, status_ptr)) {
+        OTK_LOG_ERROR("CRYPTO_signBatch failed!!");
+        return (OTK_RETURN_FAIL);
+    }
+
+    return (OTK_RETURN_OK);
+}
+
 char *KEY_getNote() 
 {
     return _keyObj.keyNote;
@@ -351,3 +662,94 @@ void KEY_setPinAuthRetryAfter(uint32_t retryAfter) {
     _keyObj.pin_retry_after = retryAfter;
     key_updateFile();
 }
+
+#if (UNITTEST)
+static void key_nodeToLegacyNode(
+    CRYPTO_HDNode    *node_ptr,
+    key_legacyHDNode *legacyNode_ptr)
+{
+    legacyNode_ptr->depth = node_ptr->depth;
+    legacyNode_ptr->fingerprint = node_ptr->fingerprint;
+    legacyNode_ptr->childNum = node_ptr->childNum;
+    memcpy(&legacyNode_ptr->chainCode, &node_ptr->chainCode, sizeof(CRYPTO_chainCode));
+    memcpy(&legacyNode_ptr->privateKey, &node_ptr->privateKey, sizeof(CRYPTO_privateKey));
+    memcpy(&legacyNode_ptr->publicKey, &node_ptr->publicKey, sizeof(CRYPTO_publicKey));
+    /* Strings kept by legacy firmware are dropped on conversion, make them garbage. */
+    memset(&legacyNode_ptr->extPublickey, '?', sizeof(CRYPTO_extPublicKey));
+    memset(&legacyNode_ptr->hexPublickey, '?', sizeof(CRYPTO_hexPublicKey));
+    memset(&legacyNode_ptr->WIFPrivatekey, '?', sizeof(CRYPTO_WIFPrivateKey));
+    memset(&legacyNode_ptr->btcAddr, '?', sizeof(CRYPTO_btcAddr));
+}
+
+static void key_nodeToRawNode(
+    CRYPTO_HDNode *node_ptr,
+    key_rawHDNode *rawNode_ptr)
+{
+    rawNode_ptr->depth = node_ptr->depth;
+    rawNode_ptr->fingerprint = node_ptr->fingerprint;
+    rawNode_ptr->childNum = node_ptr->childNum;
+    memcpy(&rawNode_ptr->chainCode, &node_ptr->chainCode, sizeof(CRYPTO_chainCode));
+    memcpy(&rawNode_ptr->privateKey, &node_ptr->privateKey, sizeof(CRYPTO_privateKey));
+    memcpy(&rawNode_ptr->publicKey, &node_ptr->publicKey, sizeof(CRYPTO_publicKey));
+}
+
+OTK_Return KEY_restoreLayout(
+    KEY_FileLayout  layout,
+    KEY_Object     *keyObj_ptr,
+    bool           *isLegacy_ptr)
+{
+    OTK_Return ret = OTK_RETURN_FAIL;
+    key_fileBuffer _fileBuf;
+    int _size = 0;
+
+    memset(&_fileBuf, 0, sizeof(_fileBuf));
+    switch (layout) {
+        case KEY_FILE_CURRENT:
+            memcpy(&_fileBuf.keyObj, keyObj_ptr, sizeof(KEY_Object));
+            _size = sizeof(KEY_Object);
+            break;
+        case KEY_FILE_SINGLE:
+            memcpy(&_fileBuf.singleObj.master, &keyObj_ptr->master, sizeof(CRYPTO_HDNode));
+            memcpy(&_fileBuf.singleObj.derivative, &keyObj_ptr->slots[0].derivative, sizeof(CRYPTO_HDNode));
+            memcpy(&_fileBuf.singleObj.path, &keyObj_ptr->slots[0].path, sizeof(CRYPTO_derivativePath));
+            _fileBuf.singleObj.pin = keyObj_ptr->pin;
+            _fileBuf.singleObj.pin_auth_failures = keyObj_ptr->pin_auth_failures;
+            _fileBuf.singleObj.pin_retry_after = keyObj_ptr->pin_retry_after;
+            memcpy(_fileBuf.singleObj.keyNote, keyObj_ptr->keyNote, KEY_NOTE_LENGTH + 1);
+            _size = sizeof(key_singleObject);
+            break;
+        case KEY_FILE_LEGACY:
+            key_nodeToLegacyNode(&keyObj_ptr->master, &_fileBuf.legacyObj.master);
+            key_nodeToLegacyNode(&keyObj_ptr->slots[0].derivative, &_fileBuf.legacyObj.derivative);
+            memcpy(&_fileBuf.legacyObj.path, &keyObj_ptr->slots[0].path, sizeof(CRYPTO_derivativePath));
+            _fileBuf.legacyObj.pin = keyObj_ptr->pin;
+            _fileBuf.legacyObj.pin_auth_failures = keyObj_ptr->pin_auth_failures;
+            _fileBuf.legacyObj.pin_retry_after = keyObj_ptr->pin_retry_after;
+            memcpy(_fileBuf.legacyObj.keyNote, keyObj_ptr->keyNote, KEY_NOTE_LENGTH + 1);
+            _size = sizeof(key_legacyObject);
+            break;
+        case KEY_FILE_RAW:
+            key_nodeToRawNode(&keyObj_ptr->master, &_fileBuf.rawObj.master);
+            key_nodeToRawNode(&keyObj_ptr->slots[0].derivative, &_fileBuf.rawObj.derivative);
+            memcpy(&_fileBuf.rawObj.path, &keyObj_ptr->slots[0].path, sizeof(CRYPTO_derivativePath));
+            _fileBuf.rawObj.pin = keyObj_ptr->pin;
+            _fileBuf.rawObj.pin_auth_failures = keyObj_ptr->pin_auth_failures;
+            _fileBuf.rawObj.pin_retry_after = keyObj_ptr->pin_retry_after;
+            memcpy(_fileBuf.rawObj.keyNote, keyObj_ptr->keyNote, KEY_NOTE_LENGTH + 1);
+            _size = sizeof(key_rawObject);
+            break;
+        default:
+            return (OTK_RETURN_FAIL);
+    }
+
+    _keySlot = 0;
+    memset(&_encodedMaster, 0, sizeof(_encodedMaster));
+    memset(_encodedSlots, 0, sizeof(_encodedSlots));
+    CRYPTO_clearVerifyCache(NULL);
+    /* Loaded file length is word aligned. */
+    ret = key_restoreFromFile(&_fileBuf, BYTES_TO_WORDS(_size) * sizeof(uint32_t), isLegacy_ptr);
+    memset(&_fileBuf, 0, sizeof(_fileBuf));
+
+    return (ret);
+}
+#endif /* (UNITTEST) */
@@ -22,6 +22,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "otk_const.h"
+#include "otk_config.h"
 #include "crypto.h"
 
 /**
@@ -31,14 +32,22 @@
 #define KEY_MASTER      (1)
 #define KEY_DEFAULT_PIN (0xFFFFFFFF)
 #define KEY_NOTE_LENGTH (64)
+#define KEY_SLOT_COUNT  (4)
 
 /**
- * @brief Key object struct.
+ * @brief Key slot struct, a derivative child key kept with its path.
  */
 typedef struct {
-    CRYPTO_HDNode           master;             /* Master Key */
     CRYPTO_HDNode           derivative;         /* Derivative Child Key */
     CRYPTO_derivativePath   path;               /* Derivative Child Key Path */
+} KEY_Slot;
+
+/**
+ * @brief Key object struct.
+ */
+typedef struct {
+    CRYPTO_HDNode           master;             /* Master Key */
+    KEY_Slot                slots[KEY_SLOT_COUNT];  /* Derivative Keys, slot 0 is the default */
     CRYPTO_signature        *signature_ptr;     /* Signed Signature */
     uint32_t                pin;                /* PIN Code */
     uint8_t                 pin_auth_failures;  /* times of pin auth failures */
@@ -47,6 +56,25 @@ typedef struct {
 } KEY_Object;
 
 
+/**
+ * @brief Select key slot used as derivative key
+ * @param[in]   slot            Slot index, 0 ~ (KEY_SLOT_COUNT - 1)
+ *
+ * @return      OTK_Return      OTK_RETURN_OK if no error, OTK_RETURN _FAIL if slot is out of range.
+ *
+ * Every slot keeps its derived child key, switching slot neither derives keys nor writes flash.
+ * Derivative key functions below, including set path and re-calculation, work on the selected slot.
+ */
+OTK_Return KEY_selectSlot(
+    uint32_t slot);
+
+/**
+ * @brief Get selected key slot
+ *
+ * @return      uint8_t         Index of selected key slot.
+ */
+uint8_t KEY_getSlot(void);
+
 /**
  * @brief Get derivative path
  *
@@ -57,7 +85,7 @@ CRYPTO_derivativePath *KEY_getDerivativePath(void);
 /**
  * @brief Get derivative path in string format.
  *
- * @return      char*          String of derivative path.
+ * @return      char*          String of derivative path, NULL if it does not fit.
  */
 char *KEY_getStrDerivativePath(void); 
 
@@ -96,6 +124,15 @@ char *KEY_getHexSignature(void);
  */
 void KEY_eraseSignature(void);
 
+/**
+ * @brief Get Hash160 of public key
+ * @param[in]   getMaster       Option, 1 - ger master's, 0 - get derivative's
+ *
+ * @return      CRYPTO_hash160*     Hash160 of public key of master or derivative key
+ */
+CRYPTO_hash160 *KEY_getHash160(
+    bool getMaster);
+
 /**
  * @brief Get Public Key in HEX string
  * @param[in]   getMaster       Option, 1 - ger master's, 0 - get derivative's
@@ -186,6 +223,30 @@ OTK_Return KEY_sign(
     size_t              hashLen,
     bool                usingMaster);
 
+/**
+ * @brief Usign master or derivative key to sign a list of hashes at once.
+ * @param[in]   hashes_ptr      count hashes of CRYPTO_HASH_SZ bytes, back to back
+ * @param[in]   count           Number of hashes
+ * @param[in]   usingMaster     Option of using master key, 1 - master, 0 - derivative
+ * @param[in]   scheme          Signature scheme, ECDSA, BIP340 Schnorr or recoverable ECDSA
+ * @param[out]  signatures_ptr  Array of count signatures, a failed item is zeroed
+ * @param[out]  recIds_ptr      Array of count recovery ids, required for recoverable ECDSA, can be NULL otherwise
+ * @param[out]  status_ptr      Array of count per-item results, can be NULL
+ *
+ * @return      OTK_Return      OTK_RETURN_OK if all items are signed and verified, OTK_RETURN _FAIL otherwise.
+ *
+ * Key import and verification key are set up once for the whole batch, signatures are
+ * written to the caller's array instead of the single KEY_getSignature slot.
+ */
+OTK_Return KEY_signBatch(
+    const uint8_t       *hashes_ptr,
+    size_t              count,
+    bool                usingMaster,
+    CRYPTO_sigScheme    scheme,
+    CRYPTO_signature    *signatures_ptr,
+    uint8_t             *recIds_ptr,
+    OTK_Return          *status_ptr);
+
 /**
  * @brief Get customized user note for Key
  *
@@ -210,5 +271,32 @@ uint32_t KEY_getPinAuthRetryAfter();
 
 void KEY_setPinAuthRetryAfter(uint32_t retryAfter);
 
+#if (UNITTEST)
+/**
+ * @brief Key file layouts ever written, for unittest of key file conversion.
+ */
+typedef enum {
+    KEY_FILE_CURRENT = 0,               /* Current layout, KEY_Object. */
+    KEY_FILE_SINGLE,                    /* Single derivative key, before slots. */
+    KEY_FILE_LEGACY,                    /* Nodes keeping string representations. */
+    KEY_FILE_RAW,                       /* Nodes without hash160. */
+} KEY_FileLayout;
+
+/**
+ * @brief Restore keys from a key file of given layout, as KEY_init does with a loaded file.
+ * @param[in]   layout          Layout of key file to be built
+ * @param[in]   keyObj_ptr      Keys and settings written to key file, older layouts only take master key and slot 0
+ * @param[out]  isLegacy_ptr    Set if the key file would be rewritten in current layout
+ *
+ * @return      OTK_Return      OTK_RETURN_OK if no error, OTK_RETURN _FAIL otherwise.
+ *
+ * Nothing is written to flash, call KEY_init afterwards to restore keys of the device.
+ */
+OTK_Return KEY_restoreLayout(
+    KEY_FileLayout  layout,
+    KEY_Object     *keyObj_ptr,
+    bool           *isLegacy_ptr);
+#endif
+
 #endif
 
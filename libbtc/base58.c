@@ -27,7 +27,7 @@
 #include <stdbool.h>
 #include <sys/types.h>
 
-#include "sha2.h"
+#include "hash.h"
 
 static const int8_t b58digits_map[] = {
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -48,8 +48,8 @@ static int b58tobin(void *bin, size_t *binszp, const char *b58)
     size_t outisz = (binsz + 3) / 4;
     uint32_t outi[outisz];
     uint64_t t;
-    uint32_t c;
-    size_t i, j;
+    uint32_t c, mult;
+    size_t i, j, k;
     uint8_t bytesleft = binsz % 4;
     uint32_t zeromask = bytesleft ? (0xffffffff << (bytesleft * 8)) : 0;
     unsigned zerocount = 0;
@@ -64,19 +64,25 @@ static int b58tobin(void *bin, size_t *binszp, const char *b58)
         ++zerocount;
     }
 
-    for ( ; i < b58sz; ++i) {
-        if (b58u[i] & 0x80) {
-            // High-bit set on invalid digit
-            return false;
-        }
-        if (b58digits_map[b58u[i]] == -1) {
-            // Invalid base58 digit
-            return false;
+    while (i < b58sz) {
+        // Take up to 5 digits per pass over outi, 58^5 still fits in 32 bits
+        c = 0;
+        mult = 1;
+        for (k = 0; k < 5 && i < b58sz; ++k, ++i) {
+            if (b58u[i] & 0x80) {
+                // High-bit set on invalid digit
+                return false;
+            }
+            if (b58digits_map[b58u[i]] == -1) {
+                // Invalid base58 digit
+                return false;
+            }
+            c = c * 58 + (unsigned)b58digits_map[b58u[i]];
+            mult *= 58;
         }
-        c = (unsigned)b58digits_map[b58u[i]];
         for (j = outisz; j--; ) {
-            t = ((uint64_t)outi[j]) * 58 + c;
-            c = (t & 0x3f00000000) >> 32;
+            t = ((uint64_t)outi[j]) * mult + c;
+            c = t >> 32;
             outi[j] = t & 0xffffffff;
         }
         if (c) {
@@ -133,8 +139,8 @@ static int b58check(const void *bin, size_t binsz, const char *base58str)
     if (binsz < 4) {
         return -4;
     }
-    sha256_Raw(bin, binsz - 4, buf);
-    sha256_Raw(buf, 32, buf);
+    hash_sha256_Raw(bin, binsz - 4, buf);
+    hash_sha256_Raw(buf, 32, buf);
     if (memcmp(&binc[binsz - 4], buf, 4)) {
         return -1;
     }
@@ -152,68 +158,119 @@ static int b58check(const void *bin, size_t binsz, const char *base58str)
 static const char b58digits_ordered[] =
     "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
-static int b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz)
+/*
+ * Encoder limbs hold B58_LIMB_DIGITS base58 digits each. 64-bit builds feed 32 bits of input
+ * per step, 32-bit builds one byte, so every product and division by the limb base stays
+ * within a native word (no 64-bit division on Cortex-M4).
+ */
+#if UINTPTR_MAX > 0xffffffffu
+#define B58_LIMB_DIGITS 5
+#define B58_LIMB_BASE   656356768u          // 58^5
+#define B58_STEP_BYTES  4
+typedef uint64_t b58_wide;
+#else
+#define B58_LIMB_DIGITS 4
+#define B58_LIMB_BASE   11316496u           // 58^4
+#define B58_STEP_BYTES  1
+typedef uint32_t b58_wide;
+#endif
+
+#define B58_MAX_BINSZ   (128 + 4)           // Data and checksum of base58_encode_check
+#define B58_MAX_LIMBS   ((B58_MAX_BINSZ * 138 / 100 + 1) / B58_LIMB_DIGITS + 1)
+
+// Byte i of data followed by tail
+#define B58_BYTE(i)     ((i) < datasz ? data[i] : tail[(i) - datasz])
+
+static int b58enc(char *b58, size_t *b58sz, const uint8_t *data, size_t datasz, const uint8_t *tail, size_t tailsz)
 {
-    const uint8_t *bin = data;
-    int carry;
-    ssize_t i, j, high, zcount = 0;
-    size_t size;
+    uint32_t limbs[B58_MAX_LIMBS];          // Little endian, base B58_LIMB_BASE
+    size_t binsz = datasz + tailsz;
+    size_t zcount = 0, nlimbs = 0, ndigits = 0;
+    size_t i, j, k, n;
+    b58_wide t, mult;
+    uint32_t carry, limb;
+    char *p;
 
-    while (zcount < (ssize_t)binsz && !bin[zcount]) {
-        ++zcount;
+    if (binsz > B58_MAX_BINSZ) {
+        return false;
     }
 
-    size = (binsz - zcount) * 138 / 100 + 1;
-    uint8_t buf[size];
-    memset(buf, 0, size);
+    while (zcount < binsz && !B58_BYTE(zcount)) {
+        ++zcount;
+    }
 
-    for (i = zcount, high = size - 1; i < (ssize_t)binsz; ++i, high = j) {
-        for (carry = bin[i], j = size - 1; (j > high) || carry; --j) {
-            carry += 256 * buf[j];
-            buf[j] = carry % 58;
-            carry /= 58;
+    // First step takes the odd bytes, the rest come in whole steps
+    k = (binsz - zcount) % B58_STEP_BYTES;
+    if (k == 0) {
+        k = B58_STEP_BYTES;
+    }
+    for (i = zcount; i < binsz; i += k, k = B58_STEP_BYTES) {
+        carry = 0;
+        for (n = 0; n < k; ++n) {
+            carry = (carry << 8) | B58_BYTE(i + n);
+        }
+        mult = (b58_wide)1 << (8 * k);
+        for (j = 0; j < nlimbs; ++j) {
+            t = (b58_wide)limbs[j] * mult + carry;
+            carry = (uint32_t)(t / B58_LIMB_BASE);
+            limbs[j] = (uint32_t)(t - (b58_wide)carry * B58_LIMB_BASE);
+        }
+        while (carry) {
+            limbs[nlimbs++] = carry % B58_LIMB_BASE;
+            carry /= B58_LIMB_BASE;
         }
     }
 
-    for (j = 0; j < (ssize_t)size && !buf[j]; ++j);
+    // Lower limbs give B58_LIMB_DIGITS digits each, the top one without leading zeros
+    if (nlimbs) {
+        ndigits = (nlimbs - 1) * B58_LIMB_DIGITS;
+        for (limb = limbs[nlimbs - 1]; limb; limb /= 58) {
+            ++ndigits;
+        }
+    }
 
-    if (*b58sz <= zcount + size - j) {
-        *b58sz = zcount + size - j + 1;
-        memset(buf, 0, size);
+    if (*b58sz <= zcount + ndigits) {
+        *b58sz = zcount + ndigits + 1;
+        memset(limbs, 0, sizeof(limbs));
         return false;
     }
 
     if (zcount) {
         memset(b58, '1', zcount);
     }
-    for (i = zcount; j < (ssize_t)size; ++i, ++j) {
-        b58[i] = b58digits_ordered[buf[j]];
+    p = b58 + zcount + ndigits;
+    *p = '\0';
+    for (j = 0; j < nlimbs; ++j) {
+        limb = limbs[j];
+        for (n = 0; (j + 1 < nlimbs) ? (n < B58_LIMB_DIGITS) : (limb != 0); ++n) {
+            *--p = b58digits_ordered[limb % 58];
+            limb /= 58;
+        }
     }
-    b58[i] = '\0';
-    *b58sz = i + 1;
+    *b58sz = zcount + ndigits + 1;
 
-    memset(buf, 0, size);
+    memset(limbs, 0, sizeof(limbs));
     return true;
 }
 
 int base58_encode_check(const uint8_t *data, int datalen, char *str, int strsize)
 {
     int ret;
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    size_t res = strsize;
+
     if (datalen > 128) {
         return 0;
     }
-    uint8_t buf[datalen + 32];
-    uint8_t *hash = buf + datalen;
-    memcpy(buf, data, datalen);
-    sha256_Raw(data, datalen, hash);
-    sha256_Raw(hash, 32, hash);
-    size_t res = strsize;
-    if (b58enc(str, &res, buf, datalen + 4) != true) {
+    hash_sha256_Raw(data, datalen, hash);
+    hash_sha256_Raw(hash, 32, hash);
+    // Checksum, first 4 bytes of the hash, is encoded right after data without copying data
+    if (b58enc(str, &res, data, datalen, hash, 4) != true) {
         ret = 0;
     } else {
         ret = res;
     }
-    memset(buf, 0, sizeof(buf));
+    memset(hash, 0, sizeof(hash));
     return ret;
 }
 
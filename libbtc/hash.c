@@ -0,0 +1,189 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+
+#include <string.h>
+
+#include "hash.h"
+
+/*** SHA-256: *********************************************************/
+void hash_sha256_Init(HASH_SHA256_CTX *ctx)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha256_init(ctx);
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha256_init(ctx);
+    mbedtls_sha256_starts(ctx, 0);
+#else
+    sha256_Init(ctx);
+#endif
+}
+
+void hash_sha256_Update(HASH_SHA256_CTX *ctx, const uint8_t *data, size_t len)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha256_update(ctx, data, len);
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha256_update(ctx, data, len);
+#else
+    sha256_Update(ctx, data, len);
+#endif
+}
+
+void hash_sha256_Final(uint8_t digest[SHA256_DIGEST_LENGTH], HASH_SHA256_CTX *ctx)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha256_final(digest, ctx);
+    memset(ctx, 0, sizeof(HASH_SHA256_CTX));
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha256_finish(ctx, digest);
+    mbedtls_sha256_free(ctx);
+#else
+    sha256_Final(digest, ctx);
+#endif
+}
+
+void hash_sha256_Raw(const uint8_t *data, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha256(digest, data, len);
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha256(data, len, digest, 0);
+#else
+    sha256_Raw(data, len, digest);
+#endif
+}
+
+/*** SHA-512: *********************************************************/
+void hash_sha512_Init(HASH_SHA512_CTX *ctx)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha512_init(ctx);
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha512_init(ctx);
+    mbedtls_sha512_starts(ctx, 0);
+#else
+    sha512_Init(ctx);
+#endif
+}
+
+void hash_sha512_Update(HASH_SHA512_CTX *ctx, const uint8_t *data, size_t len)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha512_update(ctx, data, len);
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha512_update(ctx, data, len);
+#else
+    sha512_Update(ctx, data, len);
+#endif
+}
+
+void hash_sha512_Final(uint8_t digest[SHA512_DIGEST_LENGTH], HASH_SHA512_CTX *ctx)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha512_final(digest, ctx);
+    memset(ctx, 0, sizeof(HASH_SHA512_CTX));
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha512_finish(ctx, digest);
+    mbedtls_sha512_free(ctx);
+#else
+    sha512_Final(digest, ctx);
+#endif
+}
+
+void hash_sha512_Raw(const uint8_t *data, size_t len, uint8_t digest[SHA512_DIGEST_LENGTH])
+{
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+    occ_sha512(digest, data, len);
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+    mbedtls_sha512(data, len, digest, 0);
+#else
+    sha512_Raw(data, len, digest);
+#endif
+}
+
+/*** HMAC-SHA512: *****************************************************/
+void hash_hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
+                      const uint32_t msglen, uint8_t *hmac)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_LIBBTC
+    hmac_sha512(key, keylen, msg, msglen, hmac);
+#else
+    HASH_HMAC_SHA512_CTX hctx;
+
+    hash_hmac_sha512_Prepare(key, keylen, &hctx);
+    hash_hmac_sha512_Prepared(&hctx, msg, msglen, hmac);
+    memset(&hctx, 0, sizeof(hctx));
+#endif
+}
+
+/*
+ * Hash the ipad and opad key blocks once, messages under the same key
+ * then cost two compressions less each with hash_hmac_sha512_Prepared().
+ */
+void hash_hmac_sha512_Prepare(const uint8_t *key, const uint32_t keylen, HASH_HMAC_SHA512_CTX *hctx)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_LIBBTC
+    hmac_sha512_Prepare(key, keylen, hctx);
+#else
+    int i;
+    uint8_t buf[SHA512_BLOCK_LENGTH];
+
+    memset(buf, 0, SHA512_BLOCK_LENGTH);
+    if (keylen > SHA512_BLOCK_LENGTH) {
+        hash_sha512_Raw(key, keylen, buf);
+    } else {
+        memcpy(buf, key, keylen);
+    }
+
+    for (i = 0; i < SHA512_BLOCK_LENGTH; i++) {
+        buf[i] ^= 0x36;
+    }
+    hash_sha512_Init(&hctx->inner);
+    hash_sha512_Update(&hctx->inner, buf, SHA512_BLOCK_LENGTH);
+
+    for (i = 0; i < SHA512_BLOCK_LENGTH; i++) {
+        buf[i] ^= 0x36 ^ 0x5c;
+    }
+    hash_sha512_Init(&hctx->outer);
+    hash_sha512_Update(&hctx->outer, buf, SHA512_BLOCK_LENGTH);
+
+    memset(buf, 0, sizeof(buf));
+#endif
+}
+
+void hash_hmac_sha512_Prepared(const HASH_HMAC_SHA512_CTX *hctx, const uint8_t *msg,
+                               const uint32_t msglen, uint8_t *hmac)
+{
+#if HASH_PROVIDER == HASH_PROVIDER_LIBBTC
+    hmac_sha512_Prepared(hctx, msg, msglen, hmac);
+#else
+    uint8_t buf[SHA512_DIGEST_LENGTH];
+    HASH_SHA512_CTX ctx;
+
+    /* Hash states are plain structs, resume from copies so the midstates stay reusable. */
+    memcpy(&ctx, &hctx->inner, sizeof(HASH_SHA512_CTX));
+    hash_sha512_Update(&ctx, msg, msglen);
+    hash_sha512_Final(buf, &ctx);
+
+    memcpy(&ctx, &hctx->outer, sizeof(HASH_SHA512_CTX));
+    hash_sha512_Update(&ctx, buf, SHA512_DIGEST_LENGTH);
+    hash_sha512_Final(hmac, &ctx);
+
+    memset(buf, 0, sizeof(buf));
+#endif
+}
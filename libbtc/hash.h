@@ -0,0 +1,85 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "sha2.h"
+
+/*
+ * Hash provider, selects at build time the implementation behind the hash functions below.
+ * Digest sizes are the same for all providers, see SHA256_DIGEST_LENGTH and SHA512_DIGEST_LENGTH.
+ */
+#define HASH_PROVIDER_LIBBTC    0   /* Portable C in libbtc/sha2.c */
+#define HASH_PROVIDER_OBERON    1   /* nrf_oberon, Cortex-M4 assembly */
+#define HASH_PROVIDER_MBEDTLS   2   /* mbed TLS */
+
+#ifndef HASH_PROVIDER
+#define HASH_PROVIDER HASH_PROVIDER_LIBBTC
+#endif
+
+#if HASH_PROVIDER == HASH_PROVIDER_OBERON
+#include "occ_sha256.h"
+#include "occ_sha512.h"
+#define HASH_PROVIDER_NAME "oberon"
+typedef occ_sha256_ctx HASH_SHA256_CTX;
+typedef occ_sha512_ctx HASH_SHA512_CTX;
+#elif HASH_PROVIDER == HASH_PROVIDER_MBEDTLS
+#include "mbedtls/sha256.h"
+#include "mbedtls/sha512.h"
+#define HASH_PROVIDER_NAME "mbedtls"
+typedef mbedtls_sha256_context HASH_SHA256_CTX;
+typedef mbedtls_sha512_context HASH_SHA512_CTX;
+#elif HASH_PROVIDER == HASH_PROVIDER_LIBBTC
+#define HASH_PROVIDER_NAME "libbtc"
+typedef SHA256_CTX HASH_SHA256_CTX;
+typedef SHA512_CTX HASH_SHA512_CTX;
+#else
+#error Unknown HASH_PROVIDER
+#endif
+
+#if HASH_PROVIDER == HASH_PROVIDER_LIBBTC
+typedef HMAC_SHA512_CTX HASH_HMAC_SHA512_CTX;
+#else
+/* HMAC-SHA512 key midstates, hash states after the ipad and opad key blocks. */
+typedef struct _HASH_HMAC_SHA512_CTX {
+    HASH_SHA512_CTX inner;
+    HASH_SHA512_CTX outer;
+} HASH_HMAC_SHA512_CTX;
+#endif
+
+void hash_sha256_Init(HASH_SHA256_CTX *ctx);
+void hash_sha256_Update(HASH_SHA256_CTX *ctx, const uint8_t *data, size_t len);
+void hash_sha256_Final(uint8_t digest[SHA256_DIGEST_LENGTH], HASH_SHA256_CTX *ctx);
+void hash_sha256_Raw(const uint8_t *data, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+void hash_sha512_Init(HASH_SHA512_CTX *ctx);
+void hash_sha512_Update(HASH_SHA512_CTX *ctx, const uint8_t *data, size_t len);
+void hash_sha512_Final(uint8_t digest[SHA512_DIGEST_LENGTH], HASH_SHA512_CTX *ctx);
+void hash_sha512_Raw(const uint8_t *data, size_t len, uint8_t digest[SHA512_DIGEST_LENGTH]);
+
+void hash_hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
+                      const uint32_t msglen, uint8_t *hmac);
+void hash_hmac_sha512_Prepare(const uint8_t *key, const uint32_t keylen, HASH_HMAC_SHA512_CTX *hctx);
+void hash_hmac_sha512_Prepared(const HASH_HMAC_SHA512_CTX *hctx, const uint8_t *msg,
+                               const uint32_t msglen, uint8_t *hmac);
+
+#endif
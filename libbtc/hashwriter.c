@@ -0,0 +1,78 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+#include <stdarg.h>
+
+#include "hashwriter.h"
+
+/* Start an empty text in buf, size must be at least 1. */
+void hashwriter_Init(HASH_WRITER *writer, char *buf, size_t size)
+{
+    strwriter_Init(&writer->str, buf, size);
+    hash_sha256_Init(&writer->ctx);
+}
+
+/* Append len bytes of str, as much as fits. Returns bytes appended, -1 if truncated. */
+int hashwriter_Write(HASH_WRITER *writer, const char *str, size_t len)
+{
+    size_t start = writer->str.len;
+    int ret = strwriter_Write(&writer->str, str, len);
+
+    hash_sha256_Update(&writer->ctx, (const uint8_t *)(writer->str.buf + start), writer->str.len - start);
+
+    return ret;
+}
+
+/* Append formatted text, as much as fits. Returns bytes appended, -1 if truncated. */
+int hashwriter_Printf(HASH_WRITER *writer, const char *format, ...)
+{
+    size_t start = writer->str.len;
+    va_list args;
+    int n;
+
+    va_start(args, format);
+    n = strwriter_VPrintf(&writer->str, format, args);
+    va_end(args);
+    hash_sha256_Update(&writer->ctx, (const uint8_t *)(writer->str.buf + start), writer->str.len - start);
+
+    return n;
+}
+
+/* Append a binary field, tag and length bytes followed by len bytes of value, as much as fits.
+ * Returns bytes appended, -1 if truncated or value is longer than 255 bytes. */
+int hashwriter_WriteTlv(HASH_WRITER *writer, uint8_t tag, const void *value, size_t len)
+{
+    size_t start = writer->str.len;
+    int ret = strwriter_WriteTlv(&writer->str, tag, value, len);
+
+    hash_sha256_Update(&writer->ctx, (const uint8_t *)(writer->str.buf + start), writer->str.len - start);
+
+    return ret;
+}
+
+/* SHA256 of the text. */
+void hashwriter_Final(HASH_WRITER *writer, uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    hash_sha256_Final(digest, &writer->ctx);
+}
+
+/* SHA256(SHA256()) of the text, as Bitcoin message digests. */
+void hashwriter_FinalDouble(HASH_WRITER *writer, uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    hash_sha256_Final(digest, &writer->ctx);
+    hash_sha256_Raw(digest, SHA256_DIGEST_LENGTH, digest);
+}
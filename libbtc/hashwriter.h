@@ -0,0 +1,44 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+#ifndef __HASHWRITER_H__
+#define __HASHWRITER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "hash.h"
+#include "strwriter.h"
+
+/*
+ * Hashing writer, appends text to a caller's buffer and feeds every appended byte to a
+ * running SHA256, so the digest of the text is ready as soon as the last field is written.
+ * Binary data is appended as tag (1 byte), length (1 byte), value fields.
+ */
+typedef struct _HASH_WRITER {
+    STR_WRITER  str;        /* Text written so far */
+    HASH_SHA256_CTX ctx;    /* SHA256 of str.buf[0 .. str.len - 1] */
+} HASH_WRITER;
+
+void hashwriter_Init(HASH_WRITER *writer, char *buf, size_t size);
+int hashwriter_Write(HASH_WRITER *writer, const char *str, size_t len);
+int hashwriter_Printf(HASH_WRITER *writer, const char *format, ...) __attribute__((format(printf, 2, 3)));
+int hashwriter_WriteTlv(HASH_WRITER *writer, uint8_t tag, const void *value, size_t len);
+void hashwriter_Final(HASH_WRITER *writer, uint8_t digest[SHA256_DIGEST_LENGTH]);
+void hashwriter_FinalDouble(HASH_WRITER *writer, uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+#endif
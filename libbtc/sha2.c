@@ -569,6 +569,34 @@ void sha256_Final(sha2_byte digest[], SHA256_CTX *context)
 void sha256_Raw(const sha2_byte *data, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH])
 {
     SHA256_CTX  context;
+
+    if (len < SHA256_SHORT_BLOCK_LENGTH) {
+        /*
+         * Fast path for keys, digests and other short data, they fit in one block
+         * with padding and length, so build it directly and run a single transform.
+         */
+        unsigned int    j;
+        sha2_word64     bitcount = (sha2_word64)len << 3;
+
+        MEMCPY_BCOPY(context.state, sha256_initial_hash_value, SHA256_DIGEST_LENGTH);
+        MEMCPY_BCOPY(context.buffer, data, len);
+        context.buffer[len] = 0x80;
+        MEMSET_BZERO(&context.buffer[len + 1], SHA256_SHORT_BLOCK_LENGTH - len - 1);
+        for (j = 0; j < 8; j++) {
+            context.buffer[SHA256_BLOCK_LENGTH - 1 - j] = (sha2_byte)(bitcount >> (8 * j));
+        }
+        sha256_Transform(&context, (sha2_word32 *)context.buffer);
+
+        for (j = 0; j < 8; j++) {
+            digest[4 * j] = (sha2_byte)(context.state[j] >> 24);
+            digest[4 * j + 1] = (sha2_byte)(context.state[j] >> 16);
+            digest[4 * j + 2] = (sha2_byte)(context.state[j] >> 8);
+            digest[4 * j + 3] = (sha2_byte)context.state[j];
+        }
+        MEMSET_BZERO(&context, sizeof(SHA256_CTX));
+        return;
+    }
+
     sha256_Init(&context);
     sha256_Update(&context, data, len);
     sha256_Final(digest, &context);
@@ -916,10 +944,22 @@ void hmac_sha256(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
 
 void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
                  const uint32_t msglen, uint8_t *hmac)
+{
+    HMAC_SHA512_CTX hctx;
+
+    hmac_sha512_Prepare(key, keylen, &hctx);
+    hmac_sha512_Prepared(&hctx, msg, msglen, hmac);
+    MEMSET_BZERO(&hctx, sizeof(hctx));
+}
+
+/*
+ * Hash the ipad and opad key blocks once, messages under the same key
+ * then cost two compressions less each with hmac_sha512_Prepared().
+ */
+void hmac_sha512_Prepare(const uint8_t *key, const uint32_t keylen, HMAC_SHA512_CTX *hctx)
 {
     int i;
-    uint8_t buf[SHA512_BLOCK_LENGTH], o_key_pad[SHA512_BLOCK_LENGTH],
-    i_key_pad[SHA512_BLOCK_LENGTH];
+    uint8_t buf[SHA512_BLOCK_LENGTH];
     SHA512_CTX ctx;
 
     memset(buf, 0, SHA512_BLOCK_LENGTH);
@@ -930,17 +970,41 @@ void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
     }
 
     for (i = 0; i < SHA512_BLOCK_LENGTH; i++) {
-        o_key_pad[i] = buf[i] ^ 0x5c;
-        i_key_pad[i] = buf[i] ^ 0x36;
+        buf[i] ^= 0x36;
     }
+    sha512_Init(&ctx);
+    sha512_Update(&ctx, buf, SHA512_BLOCK_LENGTH);
+    MEMCPY_BCOPY(hctx->inner, ctx.state, sizeof(hctx->inner));
 
+    for (i = 0; i < SHA512_BLOCK_LENGTH; i++) {
+        buf[i] ^= 0x36 ^ 0x5c;
+    }
     sha512_Init(&ctx);
-    sha512_Update(&ctx, i_key_pad, SHA512_BLOCK_LENGTH);
+    sha512_Update(&ctx, buf, SHA512_BLOCK_LENGTH);
+    MEMCPY_BCOPY(hctx->outer, ctx.state, sizeof(hctx->outer));
+
+    MEMSET_BZERO(buf, sizeof(buf));
+    MEMSET_BZERO(&ctx, sizeof(ctx));
+}
+
+void hmac_sha512_Prepared(const HMAC_SHA512_CTX *hctx, const uint8_t *msg,
+                          const uint32_t msglen, uint8_t *hmac)
+{
+    uint8_t buf[SHA512_DIGEST_LENGTH];
+    SHA512_CTX ctx;
+
+    /* Resume right after the key block, buffer is empty at a block boundary. */
+    MEMCPY_BCOPY(ctx.state, hctx->inner, sizeof(ctx.state));
+    ctx.bitcount[0] = SHA512_BLOCK_LENGTH << 3;
+    ctx.bitcount[1] = 0;
     sha512_Update(&ctx, msg, msglen);
     sha512_Final(buf, &ctx);
 
-    sha512_Init(&ctx);
-    sha512_Update(&ctx, o_key_pad, SHA512_BLOCK_LENGTH);
+    MEMCPY_BCOPY(ctx.state, hctx->outer, sizeof(ctx.state));
+    ctx.bitcount[0] = SHA512_BLOCK_LENGTH << 3;
+    ctx.bitcount[1] = 0;
     sha512_Update(&ctx, buf, SHA512_DIGEST_LENGTH);
     sha512_Final(hmac, &ctx);
+
+    MEMSET_BZERO(buf, sizeof(buf));
 }
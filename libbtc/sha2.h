@@ -52,6 +52,11 @@ typedef struct _SHA512_CTX {
     uint64_t    bitcount[2];
     uint8_t buffer[SHA512_BLOCK_LENGTH];
 } SHA512_CTX;
+/* HMAC-SHA512 key midstates, SHA512 states after the ipad and opad key blocks. */
+typedef struct _HMAC_SHA512_CTX {
+    uint64_t    inner[8];
+    uint64_t    outer[8];
+} HMAC_SHA512_CTX;
 
 void sha256_Init(SHA256_CTX *);
 void sha256_Update(SHA256_CTX *, const uint8_t *, size_t);
@@ -67,4 +72,7 @@ void hmac_sha256(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
                  const uint32_t msglen, uint8_t *hmac);
 void hmac_sha512(const uint8_t *key, const uint32_t keylen, const uint8_t *msg,
                  const uint32_t msglen, uint8_t *hmac);
+void hmac_sha512_Prepare(const uint8_t *key, const uint32_t keylen, HMAC_SHA512_CTX *hctx);
+void hmac_sha512_Prepared(const HMAC_SHA512_CTX *hctx, const uint8_t *msg,
+                          const uint32_t msglen, uint8_t *hmac);
 #endif
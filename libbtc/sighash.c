@@ -0,0 +1,367 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+#include <string.h>
+
+#include "sighash.h"
+
+#define SIGHASH_MAX_SCRIPT_SIZE 10000
+#define SIGHASH_P2WPKH_LEN      22
+#define SIGHASH_P2PKH_LEN       25
+
+/* Parser states, in serialization order. */
+enum {
+    SIGHASH_VERSION = 0,
+    SIGHASH_IN_COUNT,
+    SIGHASH_IN_OUTPOINT,
+    SIGHASH_IN_SCRIPT_LEN,
+    SIGHASH_IN_SCRIPT,
+    SIGHASH_IN_SEQUENCE,
+    SIGHASH_OUT_COUNT,
+    SIGHASH_OUT_VALUE,
+    SIGHASH_OUT_SCRIPT_LEN,
+    SIGHASH_OUT_SCRIPT,
+    SIGHASH_LOCKTIME,
+    SIGHASH_AMOUNT,
+    SIGHASH_DONE
+};
+
+static uint64_t sighash_readLE(const uint8_t *p, uint32_t len)
+{
+    uint64_t v = 0;
+
+    while (len-- > 0) {
+        v = (v << 8) | p[len];
+    }
+    return v;
+}
+
+static void sighash_writeLE(uint8_t *p, uint64_t v, uint32_t len)
+{
+    while (len-- > 0) {
+        *p++ = (uint8_t)v;
+        v >>= 8;
+    }
+}
+
+static void sighash_expect(SIGHASH_TX *tx, int state, uint64_t need)
+{
+    tx->state = state;
+    tx->need = need;
+    tx->fieldLen = 0;
+}
+
+/* Complete a varint in field. Returns 0 if its size byte asks for more bytes. */
+static int sighash_varint(SIGHASH_TX *tx, uint64_t *value)
+{
+    if (tx->fieldLen == 1 && tx->field[0] >= 0xfd) {
+        tx->need = 1 + (tx->field[0] == 0xfd ? 2 : tx->field[0] == 0xfe ? 4 : 8);
+        return 0;
+    }
+    *value = (tx->fieldLen == 1) ? tx->field[0] : sighash_readLE(tx->field + 1, tx->fieldLen - 1);
+    return 1;
+}
+
+/* Amounts are checked one by one and in total, so sums never overflow. */
+static int sighash_addAmount(uint64_t *total, uint64_t value)
+{
+    if (value > SIGHASH_MAX_MONEY || *total + value > SIGHASH_MAX_MONEY) {
+        return 0;
+    }
+    *total += value;
+    return 1;
+}
+
+/* Input being parsed, items counts down inputs and amounts. */
+static SIGHASH_INPUT *sighash_input(SIGHASH_TX *tx)
+{
+    return &tx->inputs[tx->inputCount - tx->items];
+}
+
+/* Output script is kept in field when short enough, tell if it pays to change key. */
+static int sighash_isChange(const SIGHASH_TX *tx)
+{
+    const uint8_t *s = tx->field;
+
+    if (!tx->hasChangeKey) {
+        return 0;
+    }
+    if (tx->fieldLen == SIGHASH_P2WPKH_LEN) {
+        /* OP_0 <20 bytes> */
+        return s[0] == 0x00 && s[1] == 0x14 && memcmp(s + 2, tx->changeHash160, 20) == 0;
+    }
+    if (tx->fieldLen == SIGHASH_P2PKH_LEN) {
+        /* OP_DUP OP_HASH160 <20 bytes> OP_EQUALVERIFY OP_CHECKSIG */
+        return s[0] == 0x76 && s[1] == 0xa9 && s[2] == 0x14 && memcmp(s + 3, tx->changeHash160, 20) == 0 &&
+               s[23] == 0x88 && s[24] == 0xac;
+    }
+    return 0;
+}
+
+static void sighash_nextOutput(SIGHASH_TX *tx)
+{
+    if (sighash_isChange(tx)) {
+        /* Never overflows, it is part of outputTotal. */
+        tx->changeTotal += tx->outputValue;
+    }
+    if (--tx->items > 0) {
+        sighash_expect(tx, SIGHASH_OUT_VALUE, 8);
+    } else {
+        sighash_expect(tx, SIGHASH_LOCKTIME, 4);
+    }
+}
+
+/* Handle a completed field. */
+static void sighash_field(SIGHASH_TX *tx)
+{
+    uint64_t v;
+
+    switch (tx->state) {
+    case SIGHASH_VERSION:
+        tx->version = (uint32_t)sighash_readLE(tx->field, 4);
+        sighash_expect(tx, SIGHASH_IN_COUNT, 1);
+        break;
+    case SIGHASH_IN_COUNT:
+        if (!sighash_varint(tx, &v)) {
+            break;
+        }
+        /* Zero inputs is the marker of witness serialization, which is not accepted. */
+        if (v == 0 || v > SIGHASH_MAX_INPUTS) {
+            tx->error = 1;
+            break;
+        }
+        tx->inputCount = (uint32_t)v;
+        tx->items = v;
+        sighash_expect(tx, SIGHASH_IN_OUTPOINT, SIGHASH_OUTPOINT_LEN);
+        break;
+    case SIGHASH_IN_OUTPOINT:
+        memcpy(sighash_input(tx)->outpoint, tx->field, SIGHASH_OUTPOINT_LEN);
+        hash_sha256_Update(&tx->prevouts, tx->field, SIGHASH_OUTPOINT_LEN);
+        sighash_expect(tx, SIGHASH_IN_SCRIPT_LEN, 1);
+        break;
+    case SIGHASH_IN_SCRIPT_LEN:
+        if (!sighash_varint(tx, &v)) {
+            break;
+        }
+        if (v > SIGHASH_MAX_SCRIPT_SIZE) {
+            tx->error = 1;
+        } else if (v > 0) {
+            /* scriptSig is not part of BIP143 digest, skip it. */
+            sighash_expect(tx, SIGHASH_IN_SCRIPT, v);
+        } else {
+            sighash_expect(tx, SIGHASH_IN_SEQUENCE, 4);
+        }
+        break;
+    case SIGHASH_IN_SEQUENCE:
+        sighash_input(tx)->sequence = (uint32_t)sighash_readLE(tx->field, 4);
+        hash_sha256_Update(&tx->sequences, tx->field, 4);
+        if (--tx->items > 0) {
+            sighash_expect(tx, SIGHASH_IN_OUTPOINT, SIGHASH_OUTPOINT_LEN);
+        } else {
+            sighash_expect(tx, SIGHASH_OUT_COUNT, 1);
+        }
+        break;
+    case SIGHASH_OUT_COUNT:
+        if (!sighash_varint(tx, &v)) {
+            break;
+        }
+        if (v == 0 || v > UINT32_MAX) {
+            tx->error = 1;
+            break;
+        }
+        tx->outputCount = (uint32_t)v;
+        tx->items = v;
+        sighash_expect(tx, SIGHASH_OUT_VALUE, 8);
+        break;
+    case SIGHASH_OUT_VALUE:
+        tx->outputValue = sighash_readLE(tx->field, 8);
+        if (!sighash_addAmount(&tx->outputTotal, tx->outputValue)) {
+            tx->error = 1;
+            break;
+        }
+        hash_sha256_Update(&tx->outputs, tx->field, 8);
+        sighash_expect(tx, SIGHASH_OUT_SCRIPT_LEN, 1);
+        break;
+    case SIGHASH_OUT_SCRIPT_LEN:
+        if (!sighash_varint(tx, &v)) {
+            break;
+        }
+        if (v > SIGHASH_MAX_SCRIPT_SIZE) {
+            tx->error = 1;
+            break;
+        }
+        hash_sha256_Update(&tx->outputs, tx->field, tx->fieldLen);
+        if (v > 0) {
+            sighash_expect(tx, SIGHASH_OUT_SCRIPT, v);
+        } else {
+            tx->fieldLen = 0;
+            sighash_nextOutput(tx);
+        }
+        break;
+    case SIGHASH_LOCKTIME:
+        tx->locktime = (uint32_t)sighash_readLE(tx->field, 4);
+        tx->items = tx->inputCount;
+        sighash_expect(tx, SIGHASH_AMOUNT, 8);
+        break;
+    case SIGHASH_AMOUNT:
+        sighash_input(tx)->amount = sighash_readLE(tx->field, 8);
+        if (!sighash_addAmount(&tx->inputTotal, sighash_input(tx)->amount)) {
+            tx->error = 1;
+            break;
+        }
+        if (--tx->items > 0) {
+            sighash_expect(tx, SIGHASH_AMOUNT, 8);
+        } else {
+            sighash_expect(tx, SIGHASH_DONE, 0);
+        }
+        break;
+    default:
+        tx->error = 1;
+        break;
+    }
+}
+
+void sighash_Init(SIGHASH_TX *tx)
+{
+    memset(tx, 0, sizeof(SIGHASH_TX));
+    hash_sha256_Init(&tx->prevouts);
+    hash_sha256_Init(&tx->sequences);
+    hash_sha256_Init(&tx->outputs);
+    sighash_expect(tx, SIGHASH_VERSION, 4);
+}
+
+/*
+ * Outputs paying to P2WPKH or P2PKH script of hash160 are counted in changeTotal.
+ * Call after sighash_Init, before data is parsed.
+ */
+void sighash_SetChangeKey(SIGHASH_TX *tx, const uint8_t hash160[20])
+{
+    memcpy(tx->changeHash160, hash160, sizeof(tx->changeHash160));
+    tx->hasChangeKey = 1;
+}
+
+/* Parse the next len bytes. Returns 0, or -1 once data is not a valid transaction. */
+int sighash_Update(SIGHASH_TX *tx, const uint8_t *data, size_t len)
+{
+    size_t n;
+
+    while (len > 0 && !tx->error) {
+        if (tx->state == SIGHASH_DONE) {
+            /* Trailing data. */
+            tx->error = 1;
+        } else if (tx->state == SIGHASH_IN_SCRIPT || tx->state == SIGHASH_OUT_SCRIPT) {
+            /* Scripts are streamed, never buffered. */
+            n = (len < tx->need) ? len : (size_t)tx->need;
+            if (tx->state == SIGHASH_OUT_SCRIPT) {
+                hash_sha256_Update(&tx->outputs, data, n);
+                /* Short scripts are also kept, to be matched against change key. */
+                if (tx->fieldLen + n <= sizeof(tx->field)) {
+                    memcpy(tx->field + tx->fieldLen, data, n);
+                }
+                tx->fieldLen += n;
+            }
+            data += n;
+            len -= n;
+            tx->need -= n;
+            if (tx->need == 0) {
+                if (tx->state == SIGHASH_IN_SCRIPT) {
+                    sighash_expect(tx, SIGHASH_IN_SEQUENCE, 4);
+                } else {
+                    sighash_nextOutput(tx);
+                }
+            }
+        } else {
+            tx->field[tx->fieldLen++] = *data++;
+            len--;
+            if (tx->fieldLen == tx->need) {
+                sighash_field(tx);
+            }
+        }
+    }
+    return tx->error ? -1 : 0;
+}
+
+static void sighash_finalDouble(HASH_SHA256_CTX *ctx, uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+
+    hash_sha256_Final(hash, ctx);
+    hash_sha256_Raw(hash, sizeof(hash), digest);
+    memset(hash, 0, sizeof(hash));
+}
+
+/*
+ * Check the whole transaction and amounts are parsed and hash the preimage prefix shared
+ * by all inputs. Returns 0, or -1 if data is incomplete, invalid or spends less than it sends.
+ */
+int sighash_Final(SIGHASH_TX *tx)
+{
+    uint8_t hash[SHA256_DIGEST_LENGTH];
+    uint8_t version[4];
+
+    if (tx->error || tx->state != SIGHASH_DONE || tx->inputTotal < tx->outputTotal) {
+        tx->error = 1;
+        return -1;
+    }
+
+    sighash_writeLE(version, tx->version, sizeof(version));
+    hash_sha256_Init(&tx->prefix);
+    hash_sha256_Update(&tx->prefix, version, sizeof(version));
+    sighash_finalDouble(&tx->prevouts, hash);
+    hash_sha256_Update(&tx->prefix, hash, sizeof(hash));
+    sighash_finalDouble(&tx->sequences, hash);
+    hash_sha256_Update(&tx->prefix, hash, sizeof(hash));
+    sighash_finalDouble(&tx->outputs, tx->hashOutputs);
+
+    return 0;
+}
+
+/* BIP143 SIGHASH_ALL digest of input index, scriptCode is serialized with its length prefix. */
+void sighash_Digest(const SIGHASH_TX *tx, uint32_t index, const uint8_t *scriptCode, size_t scriptCodeLen,
+                    uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+    const SIGHASH_INPUT *in = &tx->inputs[index];
+    HASH_SHA256_CTX ctx = tx->prefix;
+    uint8_t buf[8];
+
+    hash_sha256_Update(&ctx, in->outpoint, SIGHASH_OUTPOINT_LEN);
+    hash_sha256_Update(&ctx, scriptCode, scriptCodeLen);
+    sighash_writeLE(buf, in->amount, 8);
+    hash_sha256_Update(&ctx, buf, 8);
+    sighash_writeLE(buf, in->sequence, 4);
+    hash_sha256_Update(&ctx, buf, 4);
+    hash_sha256_Update(&ctx, tx->hashOutputs, SHA256_DIGEST_LENGTH);
+    sighash_writeLE(buf, tx->locktime, 4);
+    hash_sha256_Update(&ctx, buf, 4);
+    sighash_writeLE(buf, SIGHASH_ALL, 4);
+    hash_sha256_Update(&ctx, buf, 4);
+    sighash_finalDouble(&ctx, digest);
+}
+
+/* Digests of all inputs spending P2WPKH outputs of hash160, back to back in digests. */
+void sighash_DigestP2wpkh(const SIGHASH_TX *tx, const uint8_t hash160[20], uint8_t *digests)
+{
+    uint8_t scriptCode[26] = {0x19, 0x76, 0xa9, 0x14};
+    uint32_t i;
+
+    memcpy(scriptCode + 4, hash160, 20);
+    scriptCode[24] = 0x88;
+    scriptCode[25] = 0xac;
+    for (i = 0; i < tx->inputCount; i++) {
+        sighash_Digest(tx, i, scriptCode, sizeof(scriptCode), digests + i * SHA256_DIGEST_LENGTH);
+    }
+}
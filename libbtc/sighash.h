@@ -0,0 +1,80 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+#ifndef __SIGHASH_H__
+#define __SIGHASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "hash.h"
+
+#ifndef SIGHASH_MAX_INPUTS
+#define SIGHASH_MAX_INPUTS  16
+#endif
+
+#define SIGHASH_ALL         1
+#define SIGHASH_OUTPOINT_LEN 36
+#define SIGHASH_MAX_MONEY   ((uint64_t)21000000 * 100000000)
+
+/* Spent output of an input, as the BIP143 preimage needs it. */
+typedef struct _SIGHASH_INPUT {
+    uint8_t     outpoint[SIGHASH_OUTPOINT_LEN];    /* Previous txid and output index */
+    uint32_t    sequence;
+    uint64_t    amount;                             /* Value of spent output, satoshis */
+} SIGHASH_INPUT;
+
+/*
+ * BIP143 transaction digest engine. An unsigned transaction in non-witness serialization,
+ * followed by the 8 bytes amount of each spent output, is parsed in chunks of any size.
+ * hashPrevouts, hashSequence and hashOutputs are hashed while parsing, and the preimage
+ * prefix they share is hashed once, so every input only hashes its own part.
+ */
+typedef struct _SIGHASH_TX {
+    int         state;
+    int         error;                  /* Set once data is not a valid transaction */
+    uint8_t     field[SIGHASH_OUTPOINT_LEN];
+    uint32_t    fieldLen;               /* Bytes in field */
+    uint64_t    need;                   /* Bytes to complete current field, or to skip */
+    uint64_t    items;                  /* Inputs, outputs or amounts left */
+    uint32_t    version;
+    uint32_t    locktime;
+    uint32_t    inputCount;
+    uint32_t    outputCount;
+    uint64_t    inputTotal;             /* Satoshis spent */
+    uint64_t    outputTotal;            /* Satoshis sent, fee is inputTotal - outputTotal */
+    uint64_t    outputValue;            /* Value of output being parsed */
+    uint64_t    changeTotal;            /* Part of outputTotal paid back to change key */
+    int         hasChangeKey;
+    uint8_t     changeHash160[20];
+    SIGHASH_INPUT inputs[SIGHASH_MAX_INPUTS];
+    HASH_SHA256_CTX prevouts;
+    HASH_SHA256_CTX sequences;
+    HASH_SHA256_CTX outputs;
+    HASH_SHA256_CTX prefix;             /* Midstate of version | hashPrevouts | hashSequence */
+    uint8_t     hashOutputs[SHA256_DIGEST_LENGTH];
+} SIGHASH_TX;
+
+void sighash_Init(SIGHASH_TX *tx);
+void sighash_SetChangeKey(SIGHASH_TX *tx, const uint8_t hash160[20]);
+int sighash_Update(SIGHASH_TX *tx, const uint8_t *data, size_t len);
+int sighash_Final(SIGHASH_TX *tx);
+void sighash_Digest(const SIGHASH_TX *tx, uint32_t index, const uint8_t *scriptCode, size_t scriptCodeLen,
+                    uint8_t digest[SHA256_DIGEST_LENGTH]);
+void sighash_DigestP2wpkh(const SIGHASH_TX *tx, const uint8_t hash160[20], uint8_t *digests);
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "strwriter.h"
+
+/* Start an empty text in buf, size must be at least 1. */
+void strwriter_Init(STR_WRITER *writer, char *buf, size_t size)
+{
+    writer->buf = buf;
+    writer->size = size;
+    writer->len = 0;
+    writer->overflow = 0;
+    writer->buf[0] = '\0';
+}
+
+/* Append len bytes of str, as much as fits. Returns bytes appended, -1 if truncated. */
+int strwriter_Write(STR_WRITER *writer, const char *str, size_t len)
+{
+    size_t room = writer->size - writer->len - 1;
+    int ret = (int)len;
+
+    if (len > room) {
+        len = room;
+        writer->overflow = 1;
+        ret = -1;
+    }
+    memcpy(writer->buf + writer->len, str, len);
+    writer->len += len;
+    writer->buf[writer->len] = '\0';
+
+    return ret;
+}
+
+/* Append a binary field, tag and length bytes followed by len bytes of value, as much as fits.
+ * Returns bytes appended, -1 if truncated or value is longer than 255 bytes. */
+int strwriter_WriteTlv(STR_WRITER *writer, uint8_t tag, const void *value, size_t len)
+{
+    char header[2];
+
+    if (len > 0xFF) {
+        writer->overflow = 1;
+        return -1;
+    }
+    header[0] = (char)tag;
+    header[1] = (char)len;
+    if (strwriter_Write(writer, header, sizeof(header)) < 0 ||
+        strwriter_Write(writer, (const char *)value, len) < 0) {
+        return -1;
+    }
+
+    return (int)(sizeof(header) + len);
+}
+
+/* Append formatted text, as much as fits. Returns bytes appended, -1 if truncated. */
+int strwriter_VPrintf(STR_WRITER *writer, const char *format, va_list args)
+{
+    size_t room = writer->size - writer->len;
+    char *dest = writer->buf + writer->len;
+    int n;
+
+    n = vsnprintf(dest, room, format, args);
+    if (n < 0) {
+        /* Encoding error, drop whatever was written. */
+        *dest = '\0';
+        return -1;
+    }
+    if ((size_t)n >= room) {
+        /* vsnprintf keeps room - 1 characters and the NUL. */
+        writer->len += room - 1;
+        writer->overflow = 1;
+        return -1;
+    }
+    writer->len += n;
+
+    return n;
+}
+
+int strwriter_Printf(STR_WRITER *writer, const char *format, ...)
+{
+    va_list args;
+    int n;
+
+    va_start(args, format);
+    n = strwriter_VPrintf(writer, format, args);
+    va_end(args);
+
+    return n;
+}
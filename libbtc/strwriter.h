@@ -0,0 +1,42 @@
+/**
+ * Copyright (c), Cyphereco OU, All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided under MIT license agreement.
+ * 
+ * THIS SOFTWARE IS PROVIDED "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY, 
+ * NONINFRINGEMENT, AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. 
+ *
+ * IN NO EVENT SHALL Cyphereco OU OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, 
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, ORCONSEQUENTIAL DAMAGES 
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTEGOODS OR SERVICES; 
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * 
+ */
+
+#ifndef __STRWRITER_H__
+#define __STRWRITER_H__
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Bounded string writer, appends text at a cursor in a caller's buffer. Every append only
+ * touches the new text, and a write that does not fit is truncated and flags overflow.
+ */
+typedef struct _STR_WRITER {
+    char        *buf;       /* Text written so far, always NUL terminated */
+    size_t      size;       /* Size of buf, including the NUL */
+    size_t      len;        /* Length of text in buf */
+    int         overflow;   /* Set once a write did not fit, text is truncated */
+} STR_WRITER;
+
+void strwriter_Init(STR_WRITER *writer, char *buf, size_t size);
+int strwriter_Write(STR_WRITER *writer, const char *str, size_t len);
+int strwriter_WriteTlv(STR_WRITER *writer, uint8_t tag, const void *value, size_t len);
+int strwriter_Printf(STR_WRITER *writer, const char *format, ...) __attribute__((format(printf, 2, 3)));
+int strwriter_VPrintf(STR_WRITER *writer, const char *format, va_list args);
+
+#endif
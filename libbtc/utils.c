@@ -72,6 +72,94 @@ void utils_hex_to_bin(const char *str, unsigned char *out, int inLen, int *outLe
     *outLen = i;
 }
 
+/* Nibble value of each ASCII character, -1 for non hex characters. */
+static const int8_t hexdigits_map[128] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+};
+
+#define hex_digit(c) (((unsigned char)(c) & 0x80) ? -1 : hexdigits_map[(unsigned char)(c)])
+
+
+int utils_hex_decode(const char *str, size_t len, uint8_t *out, size_t outlen, int *err_offset)
+{
+    size_t i;
+    int8_t hi, lo;
+
+    if (len > outlen * 2) {
+        *err_offset = (int)(outlen * 2);
+        return -1;
+    }
+    for (i = 0; i + 1 < len; i += 2) {
+        hi = hex_digit(str[i]);
+        lo = hex_digit(str[i + 1]);
+        if ((hi | lo) < 0) {
+            *err_offset = (int)(hi < 0 ? i : i + 1);
+            return -1;
+        }
+        out[i / 2] = (uint8_t)((hi << 4) | lo);
+    }
+    if (len & 1) {
+        /* Odd length, blame the dangling digit itself if it is not hex either. */
+        *err_offset = (int)(hex_digit(str[len - 1]) < 0 ? len - 1 : len);
+        return -1;
+    }
+    *err_offset = -1;
+    return (int)(len / 2);
+}
+
+
+int utils_hex_to_digests(const char *str, uint8_t *digests, int maxcount, int *err_offset)
+{
+    int count = 0;
+    int nibbles = 0;
+    uint8_t *d = digests;
+    int8_t v;
+    int i;
+
+    *err_offset = -1;
+    for (i = 0; ; i++) {
+        if (str[i] == '\n' || str[i] == '\0') {
+            if (nibbles & 1) {
+                *err_offset = i;
+                break;
+            }
+            if (nibbles > 0) {
+                count++;
+                d += UTILS_DIGEST_LEN;
+                nibbles = 0;
+            }
+            if (str[i] == '\0') {
+                break;
+            }
+            continue;
+        }
+        v = hex_digit(str[i]);
+        if (v < 0 || nibbles == UTILS_DIGEST_LEN * 2 || (nibbles == 0 && count == maxcount)) {
+            *err_offset = i;
+            break;
+        }
+        if (nibbles == 0) {
+            /* Shorter digests are zero padded on the right. */
+            memset(d, 0, UTILS_DIGEST_LEN);
+        }
+        if (nibbles & 1) {
+            d[nibbles / 2] |= (uint8_t)v;
+        } else {
+            d[nibbles / 2] = (uint8_t)(v << 4);
+        }
+        nibbles++;
+    }
+    return count;
+}
+
+
 uint8_t *utils_hex_to_uint8(const char *str)
 {
     if (strlens(str) > TO_UINT8_HEX_BUF_LEN) {
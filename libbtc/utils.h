@@ -36,6 +36,7 @@
 
 #define TO_UINT8_HEX_BUF_LEN 2048
 #define VARINT_LEN 20
+#define UTILS_DIGEST_LEN 32
 
 #define strlens(s) (s == NULL ? 0 : strlen(s))
 
@@ -44,6 +45,23 @@ void utils_clear_buffers(void);
 void utils_hex_to_bin(const char *str, unsigned char *out, int inLen, int *outLen);
 void utils_bin_to_hex(unsigned char *bin_in, size_t inlen, char *hex_out);
 uint8_t *utils_hex_to_uint8(const char *str);
+
+/*
+ * Validate and decode len hex characters into out in a single pass.
+ * Returns the number of bytes decoded, or -1 with err_offset set to the offset
+ * of the first invalid character (len for odd length, outlen * 2 when too long).
+ */
+int utils_hex_decode(const char *str, size_t len, uint8_t *out, size_t outlen, int *err_offset);
+
+/*
+ * Decode a '\n' separated list of hex digests into packed UTILS_DIGEST_LEN byte
+ * entries, digests shorter than UTILS_DIGEST_LEN bytes are zero padded, empty
+ * lines are skipped. Returns the number of digests decoded before the end of
+ * str or the first error; err_offset is -1 when all of str was decoded, or the
+ * offset of the first invalid character, of an over long or odd length digest,
+ * or of the first digest beyond maxcount.
+ */
+int utils_hex_to_digests(const char *str, uint8_t *digests, int maxcount, int *err_offset);
 char *utils_uint8_to_hex(const uint8_t *bin, size_t l);
 void utils_reverse_hex(char *h, int len);
 void utils_uint64_to_varint(char *vi, int *l, uint64_t i);
@@ -36,6 +36,9 @@
 #include "mem_manager.h"
 #include "libbtc/sha2.h"
 #include "libbtc/base58.h"
+#include "libbtc/strwriter.h"
+#include "libbtc/hashwriter.h"
+#include "libbtc/sighash.h"
 #include "libbtc/utils.h"
 #include "otk.h"
 #include "nfc.h"
@@ -53,6 +56,7 @@ NRF_LOG_MODULE_REGISTER();
 /* NFC tools Android application package name */
 static const uint8_t m_android_package_name[] = {'c','o','m','.','c','y','p','h','e','r','e','c','o','.','o','p','e','n','t','u','r','n','k','e','y'};
 static const uint8_t en_code[] = {'e', 'n'};
+static const uint8_t m_bin_response_type[] = NFC_BIN_RESPONSE_TYPE;
 
 static bool m_nfc_started = false;                  /* (True), if NFC is running. */
 static bool m_nfc_restart_flag = false;             /* (True), whether to restart NFC. */
@@ -67,8 +71,13 @@ static NFC_REQUEST_COMMAND m_nfc_request_command = NFC_REQUEST_CMD_INVALID;
 static NFC_COMMAND_EXEC_STATE m_nfc_cmd_exec_state = NFC_CMD_EXEC_NA;
 static NFC_COMMAND_EXEC_FAILURE_REASON m_nfc_cmd_failure_reason = NFC_REASON_INVALID;
 
-/* Global buffer for NDEF read/write. */
-static uint8_t m_ndef_msg_buf[NFC_NDEF_MSG_BUF_SZ];
+/* Ping-pong buffers for NDEF read/write, swapped each time a new message is presented. */
+static uint8_t m_ndef_msg_bufs[2][NFC_NDEF_MSG_BUF_SZ];
+/* Buffer emulated to reader. */
+static uint8_t *m_ndef_msg_buf = m_ndef_msg_bufs[0];
+/* Buffer to build next NDEF message while reader still accesses the current one. */
+static uint8_t *m_ndef_msg_next_buf = m_ndef_msg_bufs[1];
+static bool m_nfc_busy = false;                     /* (True), if request is being executed and the result is not presented yet. */
 
 static uint32_t m_nfc_session_id = 0;               /* UINT32 random number as identification for each session. */
 static uint32_t m_nfc_request_id = 0;               /* UINT32 request ID submit via NFC request to be encoded in session data for validity check. */
@@ -77,6 +86,63 @@ static char m_nfc_request_opt_buf[NFC_REQUEST_OPT_BUF_SZ];    /* Buffer to store
 
 static bool m_nfc_auth_with_pin = false;
 
+/* Commands following the first one of a batched request, their data and options are kept in m_nfc_batch_buf. */
+typedef struct {
+    NFC_REQUEST_COMMAND command;
+    const char         *data_ptr;
+    const char         *opt_ptr;
+} nfc_batchCommand;
+
+static nfc_batchCommand m_nfc_batch[NFC_BATCH_MAX - 1];
+static int m_nfc_batch_count = 0;                   /* Number of commands following the first one. */
+static char m_nfc_batch_buf[NFC_REQUEST_DATA_BUF_SZ];
+static STR_WRITER m_nfc_batch_writer;
+
+/* Hashes of a sign request and their signatures, signed as one batch. */
+static uint8_t m_nfc_sign_hashes[NFC_SIGN_BATCH_MAX][SHA256_DIGEST_LENGTH];
+static CRYPTO_signature m_nfc_signatures[NFC_SIGN_BATCH_MAX];
+static uint8_t m_nfc_sign_rec_ids[NFC_SIGN_BATCH_MAX];
+static OTK_Return m_nfc_sign_status[NFC_SIGN_BATCH_MAX];
+
+/* Unsigned transaction of a sign request, its inputs are signed with BIP143 digests. */
+static SIGHASH_TX m_nfc_sign_tx;
+#define NFC_SIGN_TX_SUMMARY_SZ  (64)    /* Room for amount and fee following signatures. */
+/* Room for OTK state, public key and session signature following results in binary response. */
+#define NFC_BIN_TRAILER_SZ      ((2 + 4) + (2 + CRYPTO_PUBLIC_KEY_SZ) + (2 + CRYPTO_SIGNATURE_SZ))
+
+/* Session signature signed ahead, for session data of idle state. */
+#define NFC_IDLE_SESSION_DATA_SZ    (128)
+typedef struct {
+    bool    valid;
+    uint8_t digest[SHA256_DIGEST_LENGTH];           /* Double SHA256 of session data */
+    char    sigHex[CRYPTO_SIGNATURE_SZ * 2 + 1];
+} nfc_presignedSession;
+
+static nfc_presignedSession m_nfc_idle_session;
+
+#define NFC_MINT_INFO_SZ        (256)
+
+static OTK_Return nfc_setRecords();
+static OTK_Return nfc_setBusyRecords();
+
+/**
+ * @brief Convert string to UINT32 value
+ * @param[in]   str            Pointer to hex string
+ *
+ * @return      UINT32 value for valid hex string, 0 for otherwise.
+ */
+static uint32_t nfc_strToUint32(char *str) {
+    uint32_t ret;
+    char     *ptr;
+
+    ret = strtoul(str, &ptr, 10);
+    if (strlen(ptr) > 0) {
+        ret = 0;
+    }
+
+    return (ret);
+}
+
 /**
  * @brief Clear stored request command and data
  *
@@ -90,40 +156,318 @@ static void nfc_clearRequest()
 
     memset(m_nfc_request_data_buf, 0, NFC_REQUEST_DATA_BUF_SZ);
     memset(m_nfc_request_opt_buf, 0, NFC_REQUEST_OPT_BUF_SZ);
+
+    m_nfc_batch_count = 0;
+    memset(m_nfc_batch_buf, 0, NFC_REQUEST_DATA_BUF_SZ);
+    OTK_holdAuth(false);
+
+    /* Records presented after the request are read without authorization, show the default key. */
+    KEY_selectSlot(0);
 }
 
 /**
- * @brief Check if a sting is a valid hex string
- * @param[in]   str        Pointer to hex string
+ * @brief Check if a request command can be batched with others.
+ * @param[in]   command        Request command
  *
- * @return      (true) if string is valid hex, (false) otherwise
+ * @return      (True) if the command neither ends the session nor needs fingerprint enrollment.
+ *
+ * Export WIF Key is not batched, batched commands share authorization of the first command,
+ * which may be a PIN, while exporting private key must be authorized by fingerprint.
  */
-static bool nfc_isStrHex(char *str)
+static bool nfc_isBatchCommand(NFC_REQUEST_COMMAND command)
 {
+    switch (command) {
+        case NFC_REQUEST_CMD_SHOW_KEY:
+        case NFC_REQUEST_CMD_SIGN:
+        case NFC_REQUEST_CMD_SET_KEY:
+        case NFC_REQUEST_CMD_SET_PIN:
+        case NFC_REQUEST_CMD_SET_NOTE:
+            return (true);
+        default:
+            return (false);
+    }
+}
 
-    if (str[strspn(str, "0123456789abcdefABCDEF")] == 0)
-    {
-        return (true);
+/**
+ * @brief Check request option "bin=", 1 - binary response following App URI record, 0 - text records.
+ * @param[in]   opt_ptr        Request option
+ *
+ * @return      1 or 0 as the option selects, -1 if it is not presented.
+ */
+static int nfc_binOption(const char *opt_ptr)
+{
+    const char *_optPos = strstr(opt_ptr, "bin=");
+
+    if (NULL == _optPos) {
+        return (-1);
     }
-    return (false);
+
+    return ((1 == strtoul(_optPos + strlen("bin="), NULL, 10)) ? 1 : 0);
 }
 
 /**
- * @brief Convert string to UINT32 value
- * @param[in]   str            Pointer to hex string
+ * @brief Parse a record of batched commands, following the first command's records.
+ * @param[in]   recordIdx      Record index after the first command's option record
+ * @param[in]   payload        Record payload text
  *
- * @return      UINT32 value for valid hex string, 0 for otherwise.
+ * @return      (True) if the record is valid.
  */
-static uint32_t nfc_strToUint32(char *str) {
-    uint32_t ret;
-    char     *ptr;
+static bool nfc_parseBatchRecord(int recordIdx, char *payload)
+{
+    int _cmdIdx = recordIdx / NFC_BATCH_RECORD_COUNT;
+    nfc_batchCommand *_cmd_ptr;
+    int _binary;
 
-    ret = strtoul(str, &ptr, 10);
-    if (strlen(ptr) > 0) {
-        ret = 0;
+    if (_cmdIdx >= NFC_BATCH_MAX - 1) {
+        OTK_LOG_ERROR("Too many batched commands!!");
+        return (false);
     }
+    _cmd_ptr = &m_nfc_batch[_cmdIdx];
 
-    return (ret);
+    switch (recordIdx % NFC_BATCH_RECORD_COUNT) {
+        case NFC_BATCH_DEF_COMMAND:
+            if (0 == recordIdx && !nfc_isBatchCommand(m_nfc_request_command)) {
+                OTK_LOG_ERROR("Request command cannot be batched!! (%d)", m_nfc_request_command);
+                return (false);
+            }
+            _cmd_ptr->command = nfc_strToUint32(payload);
+            if (!nfc_isBatchCommand(_cmd_ptr->command)) {
+                OTK_LOG_ERROR("Request command cannot be batched!! (%s)", payload);
+                return (false);
+            }
+            _cmd_ptr->data_ptr = "";
+            _cmd_ptr->opt_ptr = "";
+            m_nfc_batch_count = _cmdIdx + 1;
+            break;
+        case NFC_BATCH_DEF_DATA:
+            if (strlen(payload) >= NFC_REQUEST_DATA_BUF_SZ) {
+                return (false);
+            }
+            _cmd_ptr->data_ptr = m_nfc_batch_writer.buf + m_nfc_batch_writer.len;
+            strwriter_Write(&m_nfc_batch_writer, payload, strlen(payload) + 1);
+            break;
+        case NFC_BATCH_DEF_OPTION:
+            if (strlen(payload) >= NFC_REQUEST_OPT_BUF_SZ) {
+                return (false);
+            }
+            _binary = nfc_binOption(payload);
+            if (_binary >= 0 && _binary != (nfc_binOption(m_nfc_request_opt_buf) > 0 ? 1 : 0)) {
+                OTK_LOG_ERROR("Batched command changes response format!! (%s)", payload);
+                return (false);
+            }
+            _cmd_ptr->opt_ptr = m_nfc_batch_writer.buf + m_nfc_batch_writer.len;
+            strwriter_Write(&m_nfc_batch_writer, payload, strlen(payload) + 1);
+            break;
+    }
+
+    return (!m_nfc_batch_writer.overflow);
+}
+
+/**
+ * @brief Load a batched command as the request command to be executed.
+ * @param[in]   batchIdx       Index of the batched command
+ */
+static void nfc_loadBatchCommand(int batchIdx)
+{
+    m_nfc_request_command = m_nfc_batch[batchIdx].command;
+    m_nfc_cmd_exec_state = NFC_CMD_EXEC_NA;
+    m_nfc_cmd_failure_reason = NFC_REASON_INVALID;
+
+    strcpy(m_nfc_request_data_buf, m_nfc_batch[batchIdx].data_ptr);
+    strcpy(m_nfc_request_opt_buf, m_nfc_batch[batchIdx].opt_ptr);
+}
+
+/**
+ * @brief Compute BIP143 digests of an unsigned transaction in request data.
+ * @param[in]   maxInputs      Maximum inputs to be signed
+ * @param[in]   useMaster      Inputs spend P2WPKH outputs of master key, or derivative key
+ *
+ * Request data is hex string of the transaction in non-witness serialization, followed by
+ * 8 bytes amount of every spent output. It is decoded and parsed in chunks, digests are
+ * written to m_nfc_sign_hashes.
+ *
+ * @return      Number of inputs, 0 if request data is not a valid transaction,
+ *              or -1 if it has more than maxInputs inputs.
+ */
+static int nfc_digestTx(int maxInputs, bool useMaster)
+{
+    uint8_t _chunk[64];
+    size_t  _len = strlen(m_nfc_request_data_buf);
+    size_t  _pos;
+    int     _errOffset;
+
+    sighash_Init(&m_nfc_sign_tx);
+    sighash_SetChangeKey(&m_nfc_sign_tx, KEY_getHash160(useMaster)->octets);
+    for (_pos = 0; _pos < _len; _pos += sizeof(_chunk) * 2) {
+        size_t _hexLen = (_len - _pos < sizeof(_chunk) * 2) ? (_len - _pos) : sizeof(_chunk) * 2;
+        int    _binLen = utils_hex_decode(m_nfc_request_data_buf + _pos, _hexLen, _chunk, sizeof(_chunk), &_errOffset);
+
+        if (_binLen < 0) {
+            OTK_LOG_ERROR("Request data transaction is not valid hex at offset %d!!", (int)_pos + _errOffset);
+            return (0);
+        }
+        if (sighash_Update(&m_nfc_sign_tx, _chunk, _binLen) < 0) {
+            break;
+        }
+    }
+    if (sighash_Final(&m_nfc_sign_tx) < 0) {
+        OTK_LOG_ERROR("Request data transaction is not valid!!");
+        return (0);
+    }
+    if ((int)m_nfc_sign_tx.inputCount > maxInputs) {
+        return (-1);
+    }
+    sighash_DigestP2wpkh(&m_nfc_sign_tx, KEY_getHash160(useMaster)->octets, (uint8_t *)m_nfc_sign_hashes);
+
+    return (m_nfc_sign_tx.inputCount);
+}
+
+/**
+ * @brief Write a text field of session data, or its binary field.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ * @param[in]   tag            Tag of binary field
+ * @param[in]   label          Label of text field
+ * @param[in]   value          Text value, NULL fails the session data as overflow
+ */
+static void nfc_writeTextField(HASH_WRITER *writer_ptr, bool binary, NFC_RESPONSE_TAG tag, const char *label, const char *value)
+{
+    if (NULL == value) {
+        writer_ptr->str.overflow = 1;
+    }
+    else if (binary) {
+        hashwriter_WriteTlv(writer_ptr, tag, value, strlen(value));
+    }
+    else {
+        hashwriter_Printf(writer_ptr, "<%s>\r\n%s\r\n", label, value);
+    }
+}
+
+/**
+ * @brief Write a number field of session data, decimal in text or 4 bytes big endian in binary.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ * @param[in]   tag            Tag of binary field
+ * @param[in]   label          Label of text field
+ * @param[in]   value          Number value
+ */
+static void nfc_writeUint32Field(HASH_WRITER *writer_ptr, bool binary, NFC_RESPONSE_TAG tag, const char *label, uint32_t value)
+{
+    if (binary) {
+        uint8_t _bin[sizeof(uint32_t)];
+
+        (void)uint32_big_encode(value, _bin);
+        hashwriter_WriteTlv(writer_ptr, tag, _bin, sizeof(_bin));
+    }
+    else {
+        hashwriter_Printf(writer_ptr, "<%s>\r\n%lu\r\n", label, value);
+    }
+}
+
+/**
+ * @brief Write a hex string field of session data, raw bytes in binary.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ * @param[in]   tag            Tag of binary field
+ * @param[in]   label          Label of text field
+ * @param[in]   hex            Hex string value, up to CRYPTO_RECOVERABLE_SIGNATURE_SZ bytes, NULL fails the session data as overflow
+ */
+static void nfc_writeHexField(HASH_WRITER *writer_ptr, bool binary, NFC_RESPONSE_TAG tag, const char *label, const char *hex)
+{
+    if (NULL == hex) {
+        writer_ptr->str.overflow = 1;
+    }
+    else if (binary) {
+        uint8_t _bin[CRYPTO_RECOVERABLE_SIGNATURE_SZ];
+        int     _errOffset;
+        int     _len = utils_hex_decode(hex, strlen(hex), _bin, sizeof(_bin), &_errOffset);
+
+        if (_len < 0) {
+            writer_ptr->str.overflow = 1;
+            return;
+        }
+        hashwriter_WriteTlv(writer_ptr, tag, _bin, _len);
+    }
+    else {
+        hashwriter_Printf(writer_ptr, "<%s>\r\n%s\r\n", label, hex);
+    }
+}
+
+/**
+ * @brief Write session data of idle state, which is the leading part of every session data.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ */
+static void nfc_writeIdleSessionData(HASH_WRITER *writer_ptr, bool binary)
+{
+    nfc_writeUint32Field(writer_ptr, binary, NFC_TAG_SESSION_ID, OTK_LABEL_SESSION_ID, m_nfc_session_id);
+
+    nfc_writeTextField(writer_ptr, binary, NFC_TAG_BITCOIN_ADDR, OTK_LABEL_BITCOIN_ADDR, KEY_getBtcAddr(KEY_DERIVATIVE));
+}
+
+/**
+ * @brief Sign session data digest with derivative key.
+ * @param[in]   digest_ptr     Double SHA256 of session data
+ *
+ * @return      char*          Signature hex string, NULL if signing failed.
+ */
+static char *nfc_signSession(const uint8_t *digest_ptr)
+{
+    KEY_eraseSignature();
+
+    if (OTK_RETURN_OK != KEY_sign(digest_ptr, SHA256_DIGEST_LENGTH, false)) {
+        return (NULL);
+    }
+
+    while (!KEY_getSignature()) {
+        __WFE();
+    }
+
+    return (KEY_getHexSignature());
+}
+
+/**
+ * @brief Sign session data of idle state ahead, in a scheduler task or at boot.
+ * @param[in]   data_ptr       Pointer of passed in data, not used.
+ * @param[in]   dataSize       Pointer of passed in data length , not used.
+ *
+ * Idle session data only changes with session ID and BTC address, so the signature is
+ * kept until its digest changes. nfc_setRecords serves it when session data matches.
+ */
+static void nfc_presignIdleSession(
+    void    *data_ptr,
+    uint16_t dataSize)
+{
+    UNUSED_PARAMETER(data_ptr);
+    UNUSED_PARAMETER(dataSize);
+
+    char _sessData[NFC_IDLE_SESSION_DATA_SZ];
+    uint8_t _dblhash[SHA256_DIGEST_LENGTH];
+    HASH_WRITER _sessWriter;
+    char *_sigHex_ptr;
+
+    hashwriter_Init(&_sessWriter, _sessData, sizeof(_sessData));
+    nfc_writeIdleSessionData(&_sessWriter, false);
+    if (_sessWriter.str.overflow) {
+        return;
+    }
+    hashwriter_FinalDouble(&_sessWriter, _dblhash);
+
+    if (m_nfc_idle_session.valid && 0 == memcmp(_dblhash, m_nfc_idle_session.digest, sizeof(_dblhash))) {
+        return;
+    }
+
+    m_nfc_idle_session.valid = false;
+    _sigHex_ptr = nfc_signSession(_dblhash);
+    if (NULL == _sigHex_ptr) {
+        OTK_LOG_ERROR("Presign idle session failed.");
+        return;
+    }
+    memcpy(m_nfc_idle_session.digest, _dblhash, sizeof(_dblhash));
+    strcpy(m_nfc_idle_session.sigHex, _sigHex_ptr);
+    m_nfc_idle_session.valid = true;
+    /* Signature copied, erase it to avoid misuse. */
+    KEY_eraseSignature();
 }
 
 /**
@@ -140,7 +484,7 @@ static void nfc_process_request() {
 
     nrf_delay_ms(20);
 
-    static NFC_COMMAND_EXEC_STATE _execState = NFC_CMD_EXEC_SUCCESS;
+    NFC_COMMAND_EXEC_STATE _execState = NFC_CMD_EXEC_SUCCESS;
 
     if (NFC_REQUEST_CMD_CANCEL == m_nfc_request_command) {
         m_nfc_cmd_exec_state = NFC_CMD_EXEC_SUCCESS;
@@ -150,6 +494,11 @@ static void nfc_process_request() {
 
     OTK_Error err = OTK_ERROR_NO_ERROR;
 
+    /* Commands of a batched request share the authorization of the first one. */
+    if (m_nfc_batch_count > 0) {
+        OTK_holdAuth(true);
+    }
+
     if (!OTK_isAuthorized() &&
         strstr(m_nfc_request_opt_buf, "pin=") != NULL &&
         m_nfc_request_command != NFC_REQUEST_CMD_EXPORT_WIF_KEY) {
@@ -172,6 +521,21 @@ static void nfc_process_request() {
         }
     }
 
+    /* Check request option, key slot of derivative key, 0 (default, if not presented) ~ (KEY_SLOT_COUNT - 1).
+     * Other slots are only accessible to authorized requests. */
+    KEY_selectSlot(0);
+    if (OTK_isAuthorized()) {
+        char    *strPos = strstr(m_nfc_request_opt_buf, "slot=");
+        if (strPos != NULL) {
+            strPos += strlen("slot=");
+            if (OTK_RETURN_OK != KEY_selectSlot(strtoul(strPos, NULL, 10))) {
+                m_nfc_cmd_exec_state = NFC_CMD_EXEC_FAIL;
+                m_nfc_cmd_failure_reason = NFC_REASON_PARAM_INVALID;
+                return;
+            }
+        }
+    }
+
     if (OTK_isAuthorized() || NFC_REQUEST_CMD_RESET == m_nfc_request_command) {
         // OTK_extend();
 
@@ -328,6 +692,87 @@ static void nfc_safelyStop(
     } 
 }
 
+/**
+ * @brief Check if request result which has been read ends OTK session, by shutdown or reset.
+ * @return      (True) if NFC has to be stopped for the end of session.
+ */
+static bool nfc_isSessionEnd()
+{
+    if (m_nfc_request_command == NFC_REQUEST_CMD_RESET) {
+        return (m_nfc_cmd_exec_state == NFC_CMD_EXEC_SUCCESS);
+    }
+
+    return (m_nfc_request_command != NFC_REQUEST_CMD_INVALID &&
+            m_nfc_request_command != NFC_REQUEST_CMD_CANCEL &&
+            m_nfc_cmd_exec_state != NFC_CMD_EXEC_NA &&
+            !m_nfc_more_cmd);
+}
+
+/**
+ * @brief Update NFC records while T4T emulation keeps running, in a scheduler task.
+ * @param[in]   data_ptr       Pointer of passed in data, not used.
+ * @param[in]   dataSize       Pointer of passed in data length , not used.
+ *
+ * Pending request is executed and its result replaces busy state presented meanwhile,
+ * or request is cleared after its result has been read, reader needs not to poll the tag again.
+ * Security shutdown and end of session still stop NFC with nfc_safelyStop.
+ */
+static void nfc_updateRecords(
+    void    *data_ptr,
+    uint16_t dataSize)
+{
+    if (!m_nfc_started) {
+        return;
+    }
+
+    if (m_nfc_security_shutdown || (m_nfc_result_has_read && nfc_isSessionEnd())) {
+        nfc_safelyStop(data_ptr, dataSize);
+        return;
+    }
+
+    if (m_nfc_request_command != NFC_REQUEST_CMD_INVALID &&
+        m_nfc_cmd_exec_state == NFC_CMD_EXEC_NA && m_nfc_processing_request) {
+        if (nfc_setBusyRecords() != OTK_RETURN_OK) {
+            OTK_LOG_ERROR("Set busy state failed!");
+        }
+
+        OTK_LOG_DEBUG("Processing reqeuset...");
+        nfc_process_request();
+    }
+    else if (m_nfc_result_has_read) {
+        m_nfc_result_has_read = false;
+        m_nfc_processing_request = false;
+
+        OTK_LOG_DEBUG("Clear all request.");
+        nfc_clearRequest();
+    }
+    else {
+        return;
+    }
+
+    if (nfc_setRecords() != OTK_RETURN_OK) {
+        /* Records are not valid, stop NFC rather than presenting them. */
+        NFC_forceStop();
+        return;
+    }
+    OTK_extend();
+
+    /* Sign idle session data again if it has changed, while waiting for reader. */
+    if (NRF_SUCCESS != app_sched_event_put(NULL, 0, nfc_presignIdleSession)) {
+        OTK_LOG_DEBUG("Cannot schedule presign task!");
+    }
+}
+
+/**
+ * @brief Schedule NFC records update after NFC callback finished.
+ */
+static void nfc_scheduleUpdate()
+{
+    if (NRF_SUCCESS != app_sched_event_put(NULL, 0, nfc_updateRecords)) {
+        OTK_LOG_DEBUG("Cannot schedule NFC update task!");
+    }
+}
+
 /**
  * @brief NFC callback function, @ref nfc_t4t_callback_t for params detail.
  * Handling NFC events
@@ -355,7 +800,7 @@ static void nfc_callback(
                 m_nfc_cmd_exec_state == NFC_CMD_EXEC_NA && !m_nfc_processing_request) {
                 m_nfc_processing_request = true;
                 OTK_LOG_DEBUG("Polling start interrupt for request process");
-                NFC_stop(true);
+                nfc_scheduleUpdate();
                 return;
             }
 
@@ -378,7 +823,7 @@ static void nfc_callback(
                 m_nfc_cmd_exec_state == NFC_CMD_EXEC_NA && !m_nfc_processing_request) {
                 m_nfc_processing_request = true;
                 OTK_LOG_DEBUG("Polling ended interrupt for request process");
-                NFC_stop(true);
+                nfc_scheduleUpdate();
                 return;
             }
 
@@ -402,12 +847,13 @@ static void nfc_callback(
         /* External Reader has read static NDEF-Data from Emulation. */            
         case NFC_T4T_EVENT_NDEF_READ:
             OTK_LOG_DEBUG("NFC reader read completed!");
+            /* Busy state is presented until request result is, it is not the result. */
             if (m_nfc_request_command != NFC_REQUEST_CMD_INVALID &&
-                m_nfc_cmd_exec_state != NFC_CMD_EXEC_NA) {
+                m_nfc_cmd_exec_state != NFC_CMD_EXEC_NA && !m_nfc_busy) {
                 m_nfc_result_has_read = true;
 
-                OTK_LOG_DEBUG("Prepare to restart NFC after reuqest resulted read.");
-                NFC_stop(true);
+                OTK_LOG_DEBUG("Prepare to update NFC records after reuqest resulted read.");
+                nfc_scheduleUpdate();
             }
             break;
 
@@ -415,6 +861,8 @@ static void nfc_callback(
         case NFC_T4T_EVENT_NDEF_UPDATED:
             if (dataLength > 0 && dataLength < NFC_MAX_RECORD_SZ) {
                 _record_idx = 0;
+                m_nfc_batch_count = 0;
+                strwriter_Init(&m_nfc_batch_writer, m_nfc_batch_buf, sizeof(m_nfc_batch_buf));
                 OTK_LOG_DEBUG("NFC reader write data (%d) bytes.", dataLength);
 
                 /* Parse it. */                
@@ -509,8 +957,11 @@ static void nfc_callback(
                             }
                             break;
                         default:
-                            OTK_LOG_ERROR("Too many records!!");
-                            _invalidRequest = true;
+                            /* Records of batched commands follow the first command. */
+                            if (!nfc_parseBatchRecord(_record_idx - NFC_REQUEST_DEF_LAST, _recordPayload_data)) {
+                                OTK_LOG_ERROR("Invalid batched request!!");
+                                _invalidRequest = true;
+                            }
                             break;
                     }
 
@@ -538,111 +989,235 @@ static void nfc_callback(
 }
 
 /**
- * @brief Set NFC records based on valid conditions.
- * All NFC records is constructed here.
- * For protected data (full key info) and calculation result (sign data signature),
- * only be constructed when conditions are met. 
- *
- * @return   OTK_Return     OTK_RETURN_OK if no error, OTK_RETURN_FAIL otherwise.
+ * @brief Encode a NDEF record and append it to NDEF message in m_ndef_msg_next_buf.
+ * @param[in]       record_ptr      Record to be appended
+ * @param[in]       location        Location of the record in NDEF message
+ * @param[in,out]   msgLen_ptr      Length of NDEF message, excluding NLEN field
+ * @param[in,out]   errCode_ptr     Error code, nothing is appended if it is already an error
  */
-static OTK_Return nfc_setRecords()
+static void nfc_appendRecord(
+    nfc_ndef_record_desc_t const *record_ptr,
+    nfc_ndef_record_location_t    location,
+    uint32_t                     *msgLen_ptr,
+    ret_code_t                   *errCode_ptr)
 {
+    if (NRF_SUCCESS != *errCode_ptr) {
+        return;
+    }
 
-    ret_code_t errCode;
-
-    uint32_t _ndef_msg_len =  sizeof(m_ndef_msg_buf);
-    uint32_t _record_length;
-    uint8_t _dblhash[SHA256_DIGEST_LENGTH] = {0};
-    char *_sigHex_ptr = NULL;
-
-    // m_nfc_output_protect_data = false;
-
-    NFC_NDEF_MSG_DEF(nfc_msg, NFC_MAX_RECORD_COUNT);
-    nfc_ndef_msg_desc_t *_ndef_msg_desc_ptr = &NFC_NDEF_MSG(nfc_msg);
+    uint32_t _len = NFC_NDEF_MSG_BUF_SZ - NLEN_FIELD_SIZE - *msgLen_ptr;
 
-    OTK_LOG_DEBUG("\r\n== NFC Records Start ==");
+    *errCode_ptr = nfc_ndef_record_encode(record_ptr, location,
+            m_ndef_msg_next_buf + NLEN_FIELD_SIZE + *msgLen_ptr, &_len);
+    if (NRF_SUCCESS == *errCode_ptr) {
+        *msgLen_ptr += _len;
+    }
+}
 
-    /* 1. Application Package URI*/
+/**
+ * @brief Encode Application Package URI record and append it to NDEF message, it is the first record.
+ * @param[in,out]   msgLen_ptr      Length of NDEF message, excluding NLEN field
+ * @param[in,out]   errCode_ptr     Error code, nothing is appended if it is already an error
+ */
+static void nfc_appendAppUriRecord(
+    uint32_t   *msgLen_ptr,
+    ret_code_t *errCode_ptr)
+{
     NFC_NDEF_RECORD_BIN_DATA_DEF(nfc_record_app_uri, TNF_EXTERNAL_TYPE, NULL, 0,
             m_android_package_name, sizeof(m_android_package_name), m_android_package_name, sizeof(m_android_package_name));
-    errCode = nfc_ndef_record_encode( &NFC_NDEF_RECORD_BIN_DATA(nfc_record_app_uri),
-                                     NDEF_MIDDLE_RECORD,
-                                     NULL,
-                                     &_record_length);
-    errCode = nfc_ndef_msg_record_add(_ndef_msg_desc_ptr, &NFC_NDEF_RECORD_BIN_DATA(nfc_record_app_uri));
+    nfc_appendRecord(&NFC_NDEF_RECORD_BIN_DATA(nfc_record_app_uri), NDEF_FIRST_RECORD, msgLen_ptr, errCode_ptr);
     OTK_LOG_RAW_INFO(OTK_LABEL_APP_URI "\r\n%s\r\n\r\n", m_android_package_name);
+}
 
-    /* 2. OTK mint information. */
-    char _mintInfo[256];
+/**
+ * @brief Encode OTK mint information record and append it to NDEF message.
+ * @param[in,out]   msgLen_ptr      Length of NDEF message, excluding NLEN field
+ * @param[in,out]   errCode_ptr     Error code, nothing is appended if it is already an error
+ */
+static void nfc_appendMintInfoRecord(
+    uint32_t   *msgLen_ptr,
+    ret_code_t *errCode_ptr)
+{
+    char _mintInfo[NFC_MINT_INFO_SZ];
+    STR_WRITER _mintWriter;
     char *ptr_mstAddr = KEY_getBtcAddr(true);
-    char _serial[11] = {0};
-    memcpy(_serial, ptr_mstAddr + strlen(ptr_mstAddr) - 10, 10);
-    sprintf(_mintInfo, "%s\r\nSerial No.: %s", OTK_MINT_INFO, _serial);
+
+    if (NRF_SUCCESS != *errCode_ptr) {
+        return;
+    }
+
+    strwriter_Init(&_mintWriter, _mintInfo, sizeof(_mintInfo));
+    strwriter_Printf(&_mintWriter, "%s", OTK_MINT_INFO);
 #ifdef DEBUG    
-    sprintf(_mintInfo, "%s (DEBUG ONLY)", OTK_MINT_INFO);
+    strwriter_Printf(&_mintWriter, " (DEBUG ONLY)");
 #endif    
-    sprintf(_mintInfo, "%s\r\nBattery Level: %s / %d mV", _mintInfo, OTK_battLevel(), OTK_battVoltage());
-    sprintf(_mintInfo, "%s\r\nNote: \r\n%s", _mintInfo, KEY_getNote());
+    /* Serial number is the last 10 characters of master key BTC address. */
+    strwriter_Printf(&_mintWriter, "\r\nSerial No.: %s", ptr_mstAddr + strlen(ptr_mstAddr) - 10);
+    strwriter_Printf(&_mintWriter, "\r\nBattery Level: %s / %d mV", OTK_battLevel(), OTK_battVoltage());
+    strwriter_Printf(&_mintWriter, "\r\nNote: \r\n%s", KEY_getNote());
+    if (_mintWriter.overflow) {
+        OTK_LOG_ERROR("Mint information is too long!!");
+        *errCode_ptr = NRF_ERROR_NO_MEM;
+        return;
+    }
 
     NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_mint_info, UTF_8, en_code, sizeof(en_code),
-            (const uint8_t *)_mintInfo, strlen(_mintInfo));
-    errCode = nfc_ndef_msg_record_add(_ndef_msg_desc_ptr, &NFC_NDEF_TEXT_RECORD_DESC(nfc_record_mint_info));
+            (const uint8_t *)_mintInfo, _mintWriter.len);
+    nfc_appendRecord(&NFC_NDEF_TEXT_RECORD_DESC(nfc_record_mint_info), NDEF_MIDDLE_RECORD, msgLen_ptr, errCode_ptr);
     OTK_LOG_RAW_INFO(OTK_LABEL_MINT_INFO "\r\n%s\r\n\r\n", _mintInfo);
+}
+
+/**
+ * @brief Get OTK state word.
+ * @param[in]   execState      Command execution state to be presented
+ *
+ * 4 bytes int to represent 4 states, 
+ * BYTE 1 (Highest) - Lock State: 0 （Unlocked) / 1 (Locked) / 2 (Authorized)
+ * BYTE 2 - Execution State: 0 (No Command) / 1 (Success) / 2 (Failed) / 3 (Busy)
+ * BYTE 3 - Request Comannd
+ * BYTE 4 - Failure Reason
+ *
+ * @return      OTK state word.
+ */
+static uint32_t nfc_otkState(NFC_COMMAND_EXEC_STATE execState)
+{
+    uint32_t _otkState = 0;
 
-    /* 3. OTK State */
-    /* 4 bytes int to represent 4 states, 
-     * BYTE 1 (Highest) - Lock State: 0 （Unlocked) / 1 (Locked) / 2 (Authorized)
-     * BYTE 2 - Execution State: 0 (No Command) / 1 (Success) / 2 (Failed)
-     * BYTE 3 - Request Comannd
-     * BYTE 4 - Failure Reason
-     */
-    unsigned int _otkState = 0;
     _otkState |= ((OTK_isAuthorized() ? 2 : OTK_isLocked() ? 1 : 0) << 24);
-    _otkState |= (m_nfc_cmd_exec_state << 16);
+    _otkState |= (execState << 16);
     _otkState |= (m_nfc_request_command << 8);
     _otkState |= (m_nfc_cmd_failure_reason);
-    char _strOtkState[8];
-    sprintf(_strOtkState, "%08X", _otkState);
+
+    return (_otkState);
+}
+
+/**
+ * @brief Append OTK state record.
+ * @param[in]       execState       Command execution state to be presented
+ * @param[in]       location        Location of the record in NDEF message
+ * @param[in,out]   msgLen_ptr      Length of NDEF message, excluding NLEN field
+ * @param[in,out]   errCode_ptr     Error code, nothing is appended if it is already an error
+ */
+static void nfc_appendStateRecord(
+    NFC_COMMAND_EXEC_STATE      execState,
+    nfc_ndef_record_location_t  location,
+    uint32_t                   *msgLen_ptr,
+    ret_code_t                 *errCode_ptr)
+{
+    char _strOtkState[9];
+    sprintf(_strOtkState, "%08lX", nfc_otkState(execState));
     NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_lock_state, UTF_8, en_code, sizeof(en_code),
             (const uint8_t *)_strOtkState, strlen(_strOtkState));
-    errCode = nfc_ndef_msg_record_add(_ndef_msg_desc_ptr, &NFC_NDEF_TEXT_RECORD_DESC(nfc_record_lock_state));
+    nfc_appendRecord(&NFC_NDEF_TEXT_RECORD_DESC(nfc_record_lock_state), location, msgLen_ptr, errCode_ptr);
     OTK_LOG_RAW_INFO(OTK_LABEL_OTK_STATE "\r\n%s\r\n\r\n", _strOtkState);
+}
 
-    /* 4. Public Key, HEX string */
-    char *_pubKey = KEY_getHexPublicKey(KEY_DERIVATIVE);
-    NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_public_key, UTF_8, en_code, sizeof(en_code),
-            (const uint8_t *)_pubKey, strlen(_pubKey));
-    errCode = nfc_ndef_msg_record_add(_ndef_msg_desc_ptr, &NFC_NDEF_TEXT_RECORD_DESC(nfc_record_public_key));
-    OTK_LOG_RAW_INFO(OTK_LABEL_PUBLIC_KEY "\r\n%s\r\n\r\n", _pubKey);
-    //OTK_LOG_RAW_INFO("Master Private Key: \r\n%s\r\n\r\n", KEY_getWIFPrivateKey(KEY_MASTER));
-    //OTK_LOG_RAW_INFO("Derivative Private Key: \r\n%s\r\n\r\n", KEY_getWIFPrivateKey(KEY_DERIVATIVE));
+/**
+ * @brief Write OTK state after a batched command to session data, leading the command result.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ */
+static void nfc_writeCommandState(HASH_WRITER *writer_ptr, bool binary)
+{
+    uint32_t _otkState = nfc_otkState(m_nfc_cmd_exec_state);
 
-    /* 5. Session Data */
-    int _sessDataLen = 0;
-    char _sessData[NFC_REQUEST_DATA_BUF_SZ] = {0};
+    if (binary) {
+        uint8_t _bin[sizeof(uint32_t)];
 
-    _sessDataLen = sprintf(_sessData, "<%s>\r\n%lu\r\n", OTK_LABEL_SESSION_ID, m_nfc_session_id);
+        (void)uint32_big_encode(_otkState, _bin);
+        hashwriter_WriteTlv(writer_ptr, NFC_TAG_COMMAND_STATE, _bin, sizeof(_bin));
+    }
+    else {
+        hashwriter_Printf(writer_ptr, "<%s>\r\n%08lX\r\n", OTK_LABEL_COMMAND_STATE, _otkState);
+    }
+}
 
-    _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_BITCOIN_ADDR, KEY_getBtcAddr(KEY_DERIVATIVE));
+/**
+ * @brief Present NDEF message built in m_ndef_msg_next_buf to reader.
+ * @param[in]   msgLen     Length of NDEF message, excluding NLEN field
+ * @param[in]   busy       (True), if the message presents busy state of a request being executed
+ *
+ * T4T emulation takes a new buffer only while it is stopped, a running emulation is stopped
+ * for the swap and started again, a reader reads either the whole previous message or the new one.
+ * Busy state message is read-only, a request written while the previous one is being executed
+ * is rejected by the tag.
+ *
+ * @return   OTK_Return     OTK_RETURN_OK if no error, OTK_RETURN_FAIL otherwise.
+ */
+static OTK_Return nfc_publishMessage(uint32_t msgLen, bool busy)
+{
+    ret_code_t errCode;
+    bool _restart = m_nfc_started;
+    uint8_t *_buf_ptr;
+
+    /* NLEN field of Type 4 Tag, message length in big endian. */
+    (void)uint16_big_encode(msgLen, m_ndef_msg_next_buf);
+
+    if (_restart) {
+        if (NRF_SUCCESS != nfc_t4t_emulation_stop()) {
+            OTK_LOG_ERROR("Stop NFC failed!");
+            return (OTK_RETURN_FAIL);
+        }
+        m_nfc_started = false;
+    }
+
+    if (busy) {
+        errCode = nfc_t4t_ndef_staticpayload_set(m_ndef_msg_next_buf, NLEN_FIELD_SIZE + msgLen);
+    }
+    else {
+        /* Run Read-Write mode for Type 4 Tag platform */
+        errCode = nfc_t4t_ndef_rwpayload_set(m_ndef_msg_next_buf, NFC_NDEF_MSG_BUF_SZ);
+    }
+    APP_ERROR_CHECK(errCode);
+    if (errCode != NRF_SUCCESS) {
+        return (OTK_RETURN_FAIL);
+    }
+
+    _buf_ptr = m_ndef_msg_buf;
+    m_ndef_msg_buf = m_ndef_msg_next_buf;
+    m_ndef_msg_next_buf = _buf_ptr;
+    m_nfc_busy = busy;
+
+    if (_restart) {
+        errCode = nfc_t4t_emulation_start();
+        APP_ERROR_CHECK(errCode);
+        if (errCode != NRF_SUCCESS) {
+            OTK_LOG_ERROR("nfc_t4t_emulation_start FAILED!");
+            return (OTK_RETURN_FAIL);
+        }
+        m_nfc_started = true;
+    }
+
+    return (OTK_RETURN_OK);
+}
 
+/**
+ * @brief Write result of the executed request command to session data.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ *
+ * Results of protected data (full key info) and calculation (sign data signature)
+ * are only written when the command has been executed successfully.
+ */
+static void nfc_writeResult(HASH_WRITER *writer_ptr, bool binary)
+{
     if (m_nfc_cmd_exec_state == NFC_CMD_EXEC_FAIL && 
         m_nfc_cmd_failure_reason == NFC_REASON_AUTH_FAILED && 
         m_nfc_auth_with_pin == true && KEY_getPinAuthRetryAfter() > 0) {
         char *_sigPubKey = KEY_getHexPublicKey(false);
 
-        _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%lu\r\n", _sessData, OTK_LABEL_REQUEST_ID, m_nfc_request_id);
-        _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_PUBLIC_KEY, _sigPubKey);
-        _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%lu\r\n", _sessData, OTK_LABEL_PIN_AUTH_SUSPEND, KEY_getPinAuthRetryAfter() - 1);
+        nfc_writeUint32Field(writer_ptr, binary, NFC_TAG_REQUEST_ID, OTK_LABEL_REQUEST_ID, m_nfc_request_id);
+        nfc_writeHexField(writer_ptr, binary, NFC_TAG_SESSION_PUBLIC_KEY, OTK_LABEL_PUBLIC_KEY, _sigPubKey);
+        nfc_writeUint32Field(writer_ptr, binary, NFC_TAG_PIN_AUTH_SUSPEND, OTK_LABEL_PIN_AUTH_SUSPEND, KEY_getPinAuthRetryAfter() - 1);
     }
     else if (m_nfc_cmd_exec_state == NFC_CMD_EXEC_SUCCESS &&
         (m_nfc_request_command == NFC_REQUEST_CMD_SHOW_KEY ||
         m_nfc_request_command == NFC_REQUEST_CMD_SIGN ||
         m_nfc_request_command == NFC_REQUEST_CMD_EXPORT_WIF_KEY)) {
-        _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%lu\r\n", _sessData, OTK_LABEL_REQUEST_ID, m_nfc_request_id);
+        nfc_writeUint32Field(writer_ptr, binary, NFC_TAG_REQUEST_ID, OTK_LABEL_REQUEST_ID, m_nfc_request_id);
 
         /* Below are protected data which require OTK user's authorization to be accessed. */
         if (NFC_REQUEST_CMD_SIGN == m_nfc_request_command) {
-            char *_strHash;
             char delim[] = "\n";
 
             /* Check request option, 1 - using master key, 0 - using derivative (default, if not presented) */
@@ -654,49 +1229,148 @@ static OTK_Return nfc_setRecords()
                 _useMaster = (1 == strtoul(strPos, &ptrTail, 10));
             }
 
-            char *_sigPubKey = KEY_getHexPublicKey(_useMaster);
-            _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_PUBLIC_KEY, _sigPubKey);
+            /* Check request option, 2 - recoverable ECDSA signature, 1 - BIP340 Schnorr signature,
+             * 0 - ECDSA signature (default, if not presented) */
+            CRYPTO_sigScheme _sigScheme = CRYPTO_SIG_ECDSA;
+            strPos = strstr(m_nfc_request_opt_buf, "sig=");
+            if (strPos != NULL) {
+                char    *ptrTail;
+                strPos += strlen("sig=");
+                switch (strtoul(strPos, &ptrTail, 10)) {
+                    case 1:
+                        _sigScheme = CRYPTO_SIG_SCHNORR;
+                        break;
+                    case 2:
+                        _sigScheme = CRYPTO_SIG_ECDSA_RECOVERABLE;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            /* Check request option, 1 - request data is an unsigned transaction, each input is signed
+             * with its BIP143 digest as P2WPKH of the signing key, 0 - request data is hashes (default, if not presented) */
+            bool    _signTx = false;
+            strPos = strstr(m_nfc_request_opt_buf, "tx=");
+            if (strPos != NULL) {
+                strPos += strlen("tx=");
+                _signTx = (1 == strtoul(strPos, NULL, 10));
+            }
+            if (_signTx && CRYPTO_SIG_SCHNORR == _sigScheme) {
+                /* BIP143 inputs are signed with ECDSA. */
+                _sigScheme = CRYPTO_SIG_ECDSA;
+            }
+            /* Recoverable signature is prefixed with a header byte, as Bitcoin compact signature. */
+            int _sigLen = (CRYPTO_SIG_ECDSA_RECOVERABLE == _sigScheme) ? CRYPTO_RECOVERABLE_SIGNATURE_SZ : CRYPTO_SIGNATURE_SZ;
 
-            _sessDataLen = sprintf(_sessData, "%s<%s>\r\n", _sessData, OTK_LABEL_REQUEST_SIG);
+            char *_sigPubKey = KEY_getHexPublicKey(_useMaster);
+            if (CRYPTO_SIG_SCHNORR == _sigScheme) {
+                /* Schnorr signatures are verified with x-only public key, skip the parity byte. */
+                _sigPubKey += 2;
+            }
+            nfc_writeHexField(writer_ptr, binary, NFC_TAG_SESSION_PUBLIC_KEY, OTK_LABEL_PUBLIC_KEY, _sigPubKey);
 
-            _strHash = strtok(m_nfc_request_data_buf, delim);
-            if (!nfc_isStrHex(_strHash)) {
-                OTK_LOG_ERROR("Request data hash is not valid!! Shutting down OTK to protect attack!");
-                OTK_shutdown(OTK_ERROR_NFC_INVALID_SIGN_DATA, false);                        
+            if (!binary) {
+                hashwriter_Printf(writer_ptr, "<%s>\r\n", OTK_LABEL_REQUEST_SIG);
             }
-            while(_strHash != NULL)
-            {
-                int _hashLen = 0;
 
-                if ((strlen(_sessData) + CRYPTO_SIGNATURE_SZ * 2 + 1) > NFC_REQUEST_DATA_BUF_SZ) {
+            /* Validate and decode all hashes in one pass, then sign them in one batch.
+             * Binary response takes a field per signature, and session signature field at the end. */
+            int _errOffset = -1;
+            int _hashMax = (NFC_REQUEST_DATA_BUF_SZ - (int)writer_ptr->str.len - (_signTx ? NFC_SIGN_TX_SUMMARY_SZ : 0) -
+                (binary ? NFC_BIN_TRAILER_SZ : 0)) / (binary ? _sigLen + 2 : _sigLen * 2 + 1);
+            if (_hashMax > NFC_SIGN_BATCH_MAX) {
+                _hashMax = NFC_SIGN_BATCH_MAX;
+            }
+            else if (_hashMax < 0) {
+                _hashMax = 0;
+            }
+            int _hashCount;
+            if (_signTx) {
+                _hashCount = nfc_digestTx(_hashMax, _useMaster);
+                if (_hashCount < 0) {
                     OTK_LOG_ERROR("Too many signatures. Shutting down OTK to protect attack!");
                     OTK_shutdown(OTK_ERROR_NFC_TOO_MANY_SIGNATURES, false);                        
                 }
+            }
+            else {
+                _hashCount = utils_hex_to_digests(m_nfc_request_data_buf, (uint8_t *)m_nfc_sign_hashes, _hashMax, &_errOffset);
+            }
+            if (_errOffset >= 0 && _hashCount == _hashMax) {
+                OTK_LOG_ERROR("Too many signatures. Shutting down OTK to protect attack!");
+                OTK_shutdown(OTK_ERROR_NFC_TOO_MANY_SIGNATURES, false);                        
+            }
+            if (_hashCount == 0) {
+                OTK_LOG_ERROR("Request data hash is not valid at offset %d!! Shutting down OTK to protect attack!", _errOffset);
+                OTK_shutdown(OTK_ERROR_NFC_INVALID_SIGN_DATA, false);                        
+            }
+            if (_errOffset >= 0) {
+                OTK_LOG_ERROR("Request data hash is not valid at offset %d, sign the first %d hashes only.", _errOffset, _hashCount);
+            }
 
-                KEY_eraseSignature();
-                utils_hex_to_bin(_strHash, _dblhash, strlen(_strHash), &_hashLen);
-                if (_hashLen == 0 || _hashLen > SHA256_DIGEST_LENGTH) {
-                    break;
+            if (OTK_RETURN_OK != KEY_signBatch((uint8_t *)m_nfc_sign_hashes, _hashCount, _useMaster, _sigScheme,
+                    m_nfc_signatures, m_nfc_sign_rec_ids, m_nfc_sign_status)) {
+                for (int i = 0; i < _hashCount; i++) {
+                    if (m_nfc_sign_status[i] != OTK_RETURN_OK) {
+                        OTK_LOG_ERROR("Sign failed, hash %d.", i);
+                    }
                 }
-                else if (OTK_RETURN_OK != KEY_sign(_dblhash, SHA256_DIGEST_LENGTH, _useMaster)) {
-                    OTK_LOG_ERROR("Sign failed.");
-                    OTK_shutdown(OTK_ERROR_NFC_SIGN_FAIL, false);                        
+                OTK_shutdown(OTK_ERROR_NFC_SIGN_FAIL, false);                        
+            }
+
+            for (int i = 0; i < _hashCount; i++) {
+                uint8_t _sig[CRYPTO_RECOVERABLE_SIGNATURE_SZ];
+                uint8_t *_sigPos = _sig;
+
+                if (CRYPTO_SIG_ECDSA_RECOVERABLE == _sigScheme) {
+                    /* Header 27 + 4 (compressed public key) + recovery id. */
+                    *_sigPos++ = 27 + 4 + m_nfc_sign_rec_ids[i];
+                }
+                memcpy(_sigPos, m_nfc_signatures[i].octets, CRYPTO_SIGNATURE_SZ);
+                if (binary) {
+                    hashwriter_WriteTlv(writer_ptr, NFC_TAG_REQUEST_SIG, _sig, _sigLen);
+                }
+                else {
+                    char _sigHex[CRYPTO_RECOVERABLE_SIGNATURE_SZ * 2 + 1];
+
+                    utils_bin_to_hex(_sig, _sigLen, _sigHex);
+                    hashwriter_Printf(writer_ptr, "%s%s", (i > 0) ? delim : "", _sigHex);
                 }
+            }
+            /* Signatures are copied, erase them and hashes to avoid misuse. */
+            memset(m_nfc_signatures, 0, sizeof(m_nfc_signatures));
+            memset(m_nfc_sign_rec_ids, 0, sizeof(m_nfc_sign_rec_ids));
+            memset(m_nfc_sign_hashes, 0, sizeof(m_nfc_sign_hashes));
+            if (!binary) {
+                hashwriter_Printf(writer_ptr, "\r\n");
+            }
 
-                /* Signing calulation may take some time, wait until it's done. */
-                while (!KEY_getSignature()) {
-                    __WFE();
+            if (_signTx) {
+                /*
+                 * Amount sent and fee in BTC, for the user to confirm what was signed.
+                 * Outputs paying back to the signing key are change, not sent.
+                 */
+                uint64_t _sent = m_nfc_sign_tx.outputTotal - m_nfc_sign_tx.changeTotal;
+                uint64_t _fee = m_nfc_sign_tx.inputTotal - m_nfc_sign_tx.outputTotal;
+
+                if (binary) {
+                    /* Satoshi, 8 bytes big endian. */
+                    uint8_t _amount[2 * sizeof(uint32_t)];
+
+                    (void)uint32_big_encode((uint32_t)(_sent >> 32), _amount);
+                    (void)uint32_big_encode((uint32_t)_sent, _amount + sizeof(uint32_t));
+                    hashwriter_WriteTlv(writer_ptr, NFC_TAG_TX_AMOUNT, _amount, sizeof(_amount));
+                    (void)uint32_big_encode((uint32_t)(_fee >> 32), _amount);
+                    (void)uint32_big_encode((uint32_t)_fee, _amount + sizeof(uint32_t));
+                    hashwriter_WriteTlv(writer_ptr, NFC_TAG_TX_FEE, _amount, sizeof(_amount));
                 }
-                _sessDataLen = sprintf(_sessData, "%s%s", _sessData, KEY_getHexSignature());
-                /* Signature is copied, erase it to avoid misuse. */
-                /* Clear hash buffer for reuse. */
-                memset(_dblhash, 0, sizeof(_dblhash));
-                _strHash = strtok(NULL, delim);
-                if (_strHash != NULL && nfc_isStrHex(_strHash)) {
-                    _sessDataLen = sprintf(_sessData, "%s%s", _sessData, delim);                    
+                else {
+                    hashwriter_Printf(writer_ptr, "<%s>\r\n%lu.%08lu\r\n", OTK_LABEL_TX_AMOUNT,
+                        (unsigned long)(_sent / 100000000), (unsigned long)(_sent % 100000000));
+                    hashwriter_Printf(writer_ptr, "<%s>\r\n%lu.%08lu\r\n", OTK_LABEL_TX_FEE,
+                        (unsigned long)(_fee / 100000000), (unsigned long)(_fee % 100000000));
                 }
+                memset(&m_nfc_sign_tx, 0, sizeof(m_nfc_sign_tx));
             }
-            _sessDataLen = sprintf(_sessData, "%s\r\n", _sessData);
 
             /* Stop OTK tasks and indicate calculated data available. */
             OTK_pause();
@@ -706,9 +1380,9 @@ static OTK_Return nfc_setRecords()
             // m_nfc_output_protect_data = true;
         }
         else if (NFC_REQUEST_CMD_SHOW_KEY == m_nfc_request_command) {
-            _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_MASTER_EXT_KEY, KEY_getExtPublicKey(KEY_MASTER));
-            _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_DERIVATIVE_EXT_KEY, KEY_getExtPublicKey(KEY_DERIVATIVE));
-            _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_DERIVATIVE_PATH, KEY_getStrDerivativePath());
+            nfc_writeTextField(writer_ptr, binary, NFC_TAG_MASTER_EXT_KEY, OTK_LABEL_MASTER_EXT_KEY, KEY_getExtPublicKey(KEY_MASTER));
+            nfc_writeTextField(writer_ptr, binary, NFC_TAG_DERIVATIVE_EXT_KEY, OTK_LABEL_DERIVATIVE_EXT_KEY, KEY_getExtPublicKey(KEY_DERIVATIVE));
+            nfc_writeTextField(writer_ptr, binary, NFC_TAG_DERIVATIVE_PATH, OTK_LABEL_DERIVATIVE_PATH, KEY_getStrDerivativePath());
 
             /* Stop OTK tasks and indicate protected data available. */
             OTK_pause();
@@ -717,7 +1391,7 @@ static OTK_Return nfc_setRecords()
             // m_nfc_output_protect_data = true;
         }
         else if (NFC_REQUEST_CMD_EXPORT_WIF_KEY == m_nfc_request_command) {
-            _sessDataLen = sprintf(_sessData, "%s<%s>\r\n%s\r\n", _sessData, OTK_LABEL_WIF_KEY, KEY_getWIFPrivateKey(KEY_DERIVATIVE));
+            nfc_writeTextField(writer_ptr, binary, NFC_TAG_WIF_KEY, OTK_LABEL_WIF_KEY, KEY_getWIFPrivateKey(KEY_DERIVATIVE));
 
             /* Stop OTK tasks and indicate protected data available. */
             OTK_pause();
@@ -726,58 +1400,234 @@ static OTK_Return nfc_setRecords()
             // m_nfc_output_protect_data = true;            
         }
     }
+}
+
+/**
+ * @brief Write result of the executed request command, and execute batched commands following it.
+ * @param[in]   writer_ptr     Session data writer
+ * @param[in]   binary         (True) for binary response
+ * @param[in]   process_ptr    Function executing the loaded request command
+ *
+ * Batched commands are executed in order, each result follows its command state,
+ * the batch stops at the first command not executed successfully.
+ */
+static void nfc_executeBatch(HASH_WRITER *writer_ptr, bool binary, void (*process_ptr)(void))
+{
+    int _batchIdx = 0;
+
+    if (0 == m_nfc_batch_count) {
+        nfc_writeResult(writer_ptr, binary);
+        return;
+    }
+
+    nfc_writeCommandState(writer_ptr, binary);
+    nfc_writeResult(writer_ptr, binary);
+    while (m_nfc_cmd_exec_state == NFC_CMD_EXEC_SUCCESS && _batchIdx < m_nfc_batch_count) {
+        nfc_loadBatchCommand(_batchIdx++);
+        process_ptr();
+        nfc_writeCommandState(writer_ptr, binary);
+        nfc_writeResult(writer_ptr, binary);
+    }
+    /* Batch executed, a repeated call presents the last command only. */
+    m_nfc_batch_count = 0;
+    OTK_holdAuth(false);
+}
+
+#if (UNITTEST)
+static NFC_unittestExec m_nfc_unittest_exec;
+
+static void nfc_unittestProcess(void)
+{
+    m_nfc_cmd_exec_state = m_nfc_unittest_exec(m_nfc_request_command, m_nfc_request_data_buf, m_nfc_request_opt_buf);
+}
+
+int NFC_runBatch(
+    NFC_REQUEST_COMMAND command,
+    char               *records[],
+    int                 recordCount,
+    NFC_unittestExec    exec,
+    char               *sessData_ptr,
+    size_t              sessDataSize)
+{
+    HASH_WRITER _writer;
+    int _batchCount;
+    int i;
+
+    nfc_clearRequest();
+    strwriter_Init(&m_nfc_batch_writer, m_nfc_batch_buf, sizeof(m_nfc_batch_buf));
+    m_nfc_request_command = command;
+    for (i = 0; i < recordCount; i++) {
+        if (!nfc_parseBatchRecord(i, records[i])) {
+            nfc_clearRequest();
+            return (-1);
+        }
+    }
+    _batchCount = m_nfc_batch_count;
+
+    m_nfc_unittest_exec = exec;
+    nfc_unittestProcess();
+    hashwriter_Init(&_writer, sessData_ptr, sessDataSize);
+    nfc_executeBatch(&_writer, false, nfc_unittestProcess);
+    nfc_clearRequest();
+
+    return (_batchCount);
+}
+#endif
+
+/**
+ * @brief Set NFC records based on valid conditions.
+ * All NFC records is constructed here.
+ * For protected data (full key info) and calculation result (sign data signature),
+ * only be constructed when conditions are met. 
+ *
+ * @return   OTK_Return     OTK_RETURN_OK if no error, OTK_RETURN_FAIL otherwise.
+ */
+static OTK_Return nfc_setRecords()
+{
+
+    ret_code_t errCode = NRF_SUCCESS;
+
+    uint32_t _ndef_msg_len = 0;
+    uint8_t _dblhash[SHA256_DIGEST_LENGTH] = {0};
+    char *_sigHex_ptr = NULL;
+
+    // m_nfc_output_protect_data = false;
+
+    /* Response format of the first command, text records if not presented. Batched commands do not change it. */
+    bool    _binary = (nfc_binOption(m_nfc_request_opt_buf) > 0);
+
+    OTK_LOG_DEBUG("\r\n== NFC Records Start ==");
+
+    /* 1. Application Package URI*/
+    nfc_appendAppUriRecord(&_ndef_msg_len, &errCode);
+
+    /* 5. Session Data */
+    char _sessData[NFC_REQUEST_DATA_BUF_SZ] = {0};
+    HASH_WRITER _sessWriter;
+
+    /* Session data is hashed while it is written, the digest is ready for signing at the end. */
+    hashwriter_Init(&_sessWriter, _sessData, sizeof(_sessData));
+
+    nfc_writeIdleSessionData(&_sessWriter, _binary);
+    nfc_executeBatch(&_sessWriter, _binary, nfc_process_request);
+
+    if (_binary) {
+        /* OTK state and public key after batched commands, they are signed along with session data. */
+        uint8_t _otkState[sizeof(uint32_t)];
+
+        (void)uint32_big_encode(nfc_otkState(m_nfc_cmd_exec_state), _otkState);
+        hashwriter_WriteTlv(&_sessWriter, NFC_TAG_OTK_STATE, _otkState, sizeof(_otkState));
+        hashwriter_WriteTlv(&_sessWriter, NFC_TAG_PUBLIC_KEY, KEY_getPublicKey(KEY_DERIVATIVE)->octets, CRYPTO_PUBLIC_KEY_SZ);
+    }
+    if (_sessWriter.str.overflow) {
+        OTK_LOG_ERROR("Session data is too long!!");
+        return (OTK_RETURN_FAIL);
+    }
+
+    if (!_binary) {
+        /* 2. OTK mint information. */
+        nfc_appendMintInfoRecord(&_ndef_msg_len, &errCode);
+
+        /* 3. OTK State */
+        nfc_appendStateRecord(m_nfc_cmd_exec_state, NDEF_MIDDLE_RECORD, &_ndef_msg_len, &errCode);
+
+        /* 4. Public Key, HEX string */
+        char *_pubKey = KEY_getHexPublicKey(KEY_DERIVATIVE);
+        NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_public_key, UTF_8, en_code, sizeof(en_code),
+                (const uint8_t *)_pubKey, strlen(_pubKey));
+        nfc_appendRecord(&NFC_NDEF_TEXT_RECORD_DESC(nfc_record_public_key), NDEF_MIDDLE_RECORD, &_ndef_msg_len, &errCode);
+        OTK_LOG_RAW_INFO(OTK_LABEL_PUBLIC_KEY "\r\n%s\r\n\r\n", _pubKey);
+        //OTK_LOG_RAW_INFO("Master Private Key: \r\n%s\r\n\r\n", KEY_getWIFPrivateKey(KEY_MASTER));
+        //OTK_LOG_RAW_INFO("Derivative Private Key: \r\n%s\r\n\r\n", KEY_getWIFPrivateKey(KEY_DERIVATIVE));
+    }
 
     /* Append session data record. */
-    NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_session_data, UTF_8, en_code, sizeof(en_code),
-            (const uint8_t *)_sessData, _sessDataLen);
-    errCode = nfc_ndef_msg_record_add(_ndef_msg_desc_ptr, &NFC_NDEF_TEXT_RECORD_DESC(nfc_record_session_data));
-    OTK_LOG_RAW_INFO(OTK_LABEL_SESSION_DATA "\r\n%s\r\n", _sessData);
+    if (!_binary) {
+        NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_session_data, UTF_8, en_code, sizeof(en_code),
+                (const uint8_t *)_sessData, _sessWriter.str.len);
+        nfc_appendRecord(&NFC_NDEF_TEXT_RECORD_DESC(nfc_record_session_data), NDEF_MIDDLE_RECORD, &_ndef_msg_len, &errCode);
+        OTK_LOG_RAW_INFO(OTK_LABEL_SESSION_DATA "\r\n%s\r\n", _sessData);
+    }
 
     /* 6. Session signature */
     /* Clear hash buffer for reuse. */
     memset(_dblhash, 0, sizeof(_dblhash));
-    sha256_Raw((uint8_t*)_sessData, _sessDataLen, _dblhash);
-    sha256_Raw(_dblhash, SHA256_DIGEST_LENGTH, _dblhash);
+    hashwriter_FinalDouble(&_sessWriter, _dblhash);
 
-    KEY_eraseSignature();
+    if (_binary) {
+        /* Session signature is the last field, binary response is one record following App URI record. */
+        if (NULL == nfc_signSession(_dblhash)) {
+            OTK_LOG_ERROR("Sign failed.");
+            OTK_shutdown(OTK_ERROR_NFC_SIGN_FAIL, false);
+            return (OTK_RETURN_FAIL);
+        }
+        /* Hash context is finalized, the signature is appended to the text only. */
+        strwriter_WriteTlv(&_sessWriter.str, NFC_TAG_SESSION_SIG, KEY_getSignature()->octets, CRYPTO_SIGNATURE_SZ);
+        /* Signature copied, erase it to avoid misuse. */
+        KEY_eraseSignature();
+        if (_sessWriter.str.overflow) {
+            OTK_LOG_ERROR("Session data is too long!!");
+            return (OTK_RETURN_FAIL);
+        }
 
-    if (OTK_RETURN_OK != KEY_sign(_dblhash, SHA256_DIGEST_LENGTH, false)) {
-        OTK_LOG_ERROR("Sign failed.");
-        OTK_shutdown(OTK_ERROR_NFC_SIGN_FAIL, false);        
+        NFC_NDEF_RECORD_BIN_DATA_DEF(nfc_record_bin_response, TNF_MEDIA_TYPE, NULL, 0,
+                m_bin_response_type, sizeof(m_bin_response_type) - 1, (const uint8_t *)_sessData, _sessWriter.str.len);
+        nfc_appendRecord(&NFC_NDEF_RECORD_BIN_DATA(nfc_record_bin_response), NDEF_LAST_RECORD, &_ndef_msg_len, &errCode);
+        OTK_LOG_RAW_INFO(NFC_BIN_RESPONSE_TYPE "\r\n(%u bytes)", _sessWriter.str.len);
     }
-
-    while (!KEY_getSignature()) {
-        __WFE();
+    else {
+        if (m_nfc_idle_session.valid && 0 == memcmp(_dblhash, m_nfc_idle_session.digest, sizeof(_dblhash))) {
+            /* Idle session data, signed ahead. */
+            _sigHex_ptr = m_nfc_idle_session.sigHex;
+        }
+        else {
+            _sigHex_ptr = nfc_signSession(_dblhash);
+            if (NULL == _sigHex_ptr) {
+                OTK_LOG_ERROR("Sign failed.");
+                OTK_shutdown(OTK_ERROR_NFC_SIGN_FAIL, false);
+                return (OTK_RETURN_FAIL);
+            }
+        }
+        NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_session_sig, UTF_8, en_code, sizeof(en_code),
+                (const uint8_t *)_sigHex_ptr, strlen(_sigHex_ptr));
+        /* Signature copied, erase it to avoid misuse. */
+        nfc_appendRecord(&NFC_NDEF_TEXT_RECORD_DESC(nfc_record_session_sig), NDEF_LAST_RECORD, &_ndef_msg_len, &errCode);
+        OTK_LOG_RAW_INFO(OTK_LABEL_SESSION_SIG "\r\n%s", _sigHex_ptr);
     }
 
-    _sigHex_ptr = KEY_getHexSignature();
-    NFC_NDEF_TEXT_RECORD_DESC_DEF(nfc_record_session_sig, UTF_8, en_code, sizeof(en_code),
-            (const uint8_t *)_sigHex_ptr, strlen(_sigHex_ptr));
-    /* Signature copied, erase it to avoid misuse. */
-    errCode = nfc_ndef_msg_record_add(_ndef_msg_desc_ptr, &NFC_NDEF_TEXT_RECORD_DESC(nfc_record_session_sig));
-    OTK_LOG_RAW_INFO(OTK_LABEL_SESSION_SIG "\r\n%s", _sigHex_ptr);
-
     /* End of NFC record creation */
     nrf_delay_ms(10);   /* Delay for long data print completion. */
     OTK_LOG_RAW_INFO("\r\n==  NFC Records End  ==\r\n");
 
-    errCode = nfc_ndef_msg_encode(_ndef_msg_desc_ptr, m_ndef_msg_buf, &_ndef_msg_len);
-
     m_nfc_auth_with_pin = false;
 
     APP_ERROR_CHECK(errCode);
     if (errCode != NRF_SUCCESS) {
         return (OTK_RETURN_FAIL);
     }
-    /* Run Read-Write mode for Type 4 Tag platform */
-    errCode = nfc_t4t_ndef_rwpayload_set(m_ndef_msg_buf, sizeof(m_ndef_msg_buf));
 
-    APP_ERROR_CHECK(errCode);
+    return (nfc_publishMessage(_ndef_msg_len, false));
+}
+
+/**
+ * @brief Set NFC records presenting busy state, while a request is being executed.
+ * App URI and mint info records are followed by OTK state record.
+ *
+ * @return   OTK_Return     OTK_RETURN_OK if no error, OTK_RETURN_FAIL otherwise.
+ */
+static OTK_Return nfc_setBusyRecords()
+{
+    ret_code_t errCode = NRF_SUCCESS;
+    uint32_t _ndef_msg_len = 0;
+
+    nfc_appendAppUriRecord(&_ndef_msg_len, &errCode);
+    nfc_appendMintInfoRecord(&_ndef_msg_len, &errCode);
+    nfc_appendStateRecord(NFC_CMD_EXEC_BUSY, NDEF_LAST_RECORD, &_ndef_msg_len, &errCode);
     if (errCode != NRF_SUCCESS) {
         return (OTK_RETURN_FAIL);
     }
 
-    return (OTK_RETURN_OK);
+    return (nfc_publishMessage(_ndef_msg_len, true));
 }
 
 OTK_Return NFC_init(void)
@@ -788,6 +1638,10 @@ OTK_Return NFC_init(void)
 
     OTK_LOG_DEBUG("NFC Session ID: <%lu>", m_nfc_session_id);
 
+    /* Keys are ready, sign idle session data before the first NFC_start. */
+    m_nfc_idle_session.valid = false;
+    nfc_presignIdleSession(NULL, 0);
+
     errCode = nfc_t4t_setup(nfc_callback, NULL);
     if (errCode != NRF_SUCCESS) {
         return (OTK_RETURN_FAIL);
@@ -815,6 +1669,11 @@ OTK_Return NFC_start(void)
         }
         OTK_LOG_DEBUG("NFC started.");
         m_nfc_started = true;
+
+        /* Sign idle session data again if it has changed, while waiting for reader. */
+        if (NRF_SUCCESS != app_sched_event_put(NULL, 0, nfc_presignIdleSession)) {
+            OTK_LOG_DEBUG("Cannot schedule presign task!");
+        }
     }
     OTK_extend();
 
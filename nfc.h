@@ -20,6 +20,7 @@
 #define _NFC_H_
 
 #include "nfc_ndef_msg.h"
+#include "otk_config.h"
 
 /**
  * @brief NFC is only inteface of OTK which allows external user input.
@@ -35,6 +36,7 @@
 
 #define NFC_REQUEST_DATA_BUF_SZ  (NFC_MAX_RECORD_SZ - NLEN_FIELD_SIZE)
 #define NFC_REQUEST_OPT_BUF_SZ   (64 - NLEN_FIELD_SIZE)
+#define NFC_SIGN_BATCH_MAX       (NFC_REQUEST_DATA_BUF_SZ / (CRYPTO_SIGNATURE_SZ + 2))  /* Maximum hashes of a sign request, signatures in binary response. */
 
 /**
  * @brief NFC session data record definitions.
@@ -56,6 +58,39 @@ typedef enum {
 
 #define NFC_MAX_RECORD_COUNT  NFC_RECORD_DEF_LAST  /* Maximum NFC output records. */
 
+/**
+ * @brief NFC binary response field definitions.
+ *
+ * With request option "bin=1", records following App URI record are replaced with one
+ * record of media type NFC_BIN_RESPONSE_TYPE. Its payload is fields of tag (1 byte),
+ * length (1 byte) and value, in the order of session data text. Numbers are big endian,
+ * keys and signatures are raw bytes, other values are text without labels.
+ * OTK state and public key follow session data, reflecting the state after batched commands.
+ * Session signature is the last field, it signs double SHA256 of all preceding fields.
+ */
+#define NFC_BIN_RESPONSE_TYPE   "application/vnd.openturnkey"
+
+typedef enum {
+    NFC_TAG_INVALID = 0x00,             /* 0x00, Invalid, for check purpose. */
+    NFC_TAG_OTK_STATE,                  /* 0x01, OTK state, 4 bytes. */
+    NFC_TAG_PUBLIC_KEY,                 /* 0x02, Derivative public key, 33 bytes compressed. */
+    NFC_TAG_SESSION_ID,                 /* 0x03, Session ID, 4 bytes. */
+    NFC_TAG_BITCOIN_ADDR,               /* 0x04, BTC address of derivative key, text. */
+    NFC_TAG_REQUEST_ID,                 /* 0x05, Request ID, 4 bytes. */
+    NFC_TAG_SESSION_PUBLIC_KEY,         /* 0x06, Public key in session data, 33 bytes, 32 bytes x-only for Schnorr. */
+    NFC_TAG_REQUEST_SIG,                /* 0x07, Request signature, 64 bytes, 65 bytes recoverable, one field per hash. */
+    NFC_TAG_TX_AMOUNT,                  /* 0x08, Transaction amount in satoshi, change excluded, 8 bytes. */
+    NFC_TAG_TX_FEE,                     /* 0x09, Transaction fee in satoshi, 8 bytes. */
+    NFC_TAG_PIN_AUTH_SUSPEND,           /* 0x0A, Seconds before PIN authentication is allowed, 4 bytes. */
+    NFC_TAG_MASTER_EXT_KEY,             /* 0x0B, Master extended public key, text. */
+    NFC_TAG_DERIVATIVE_EXT_KEY,         /* 0x0C, Derivative extended public key, text. */
+    NFC_TAG_DERIVATIVE_PATH,            /* 0x0D, Derivative path, text. */
+    NFC_TAG_WIF_KEY,                    /* 0x0E, Derivative private key in WIF, text. */
+    NFC_TAG_SESSION_SIG,                /* 0x0F, Session signature, 64 bytes. */
+    NFC_TAG_COMMAND_STATE,              /* 0x10, OTK state after a batched command, 4 bytes, leading its result. */
+    NFC_TAG_LAST                        /* -, Not used, only for completion. */
+} NFC_RESPONSE_TAG;
+
 /**
  * @brief NFC request record type definitions.
  * A VALID NFC request should contain at least the FIRST THREE records
@@ -74,6 +109,28 @@ typedef enum {
 
 #define NFC_MAX_REQUEST_COUNT  NFC_REQUEST_DEF_LAST  /* Maximum NFC output records. */
 
+/**
+ * @brief NFC batched request definitions.
+ * More commands may follow the first one in the same request, each as command, data and
+ * option records. Data and option records are optional for the last command only.
+ * Commands are executed in order, sharing the authorization of the first one, and the batch
+ * stops at the first command not executed successfully. In session data, the result of each
+ * command follows the OTK state after it. Only commands which neither end the session nor
+ * need fingerprint enrollment can be batched, Show Key, Sign, Set Key, Set PIN and Set Note.
+ * Export WIF Key must be authorized by fingerprint on its own, it is never batched.
+ * Option "bin=" of the first command selects response format of the whole batch, a batched
+ * command may repeat it but must not change it.
+ */
+typedef enum {
+    NFC_BATCH_DEF_COMMAND = 0,          /* Batched request command. */
+    NFC_BATCH_DEF_DATA,                 /* Request data of the batched command. */
+    NFC_BATCH_DEF_OPTION,               /* Request option of the batched command. */
+    NFC_BATCH_DEF_LAST                  /* Not used, for completion only. */
+} NFC_BATCH_DEF;
+
+#define NFC_BATCH_MAX           (4)                     /* Maximum commands of a batched request. */
+#define NFC_BATCH_RECORD_COUNT  NFC_BATCH_DEF_LAST      /* Records of each batched command. */
+
 /**
  * @brief NFC rquest command definitions.
  */
@@ -81,9 +138,9 @@ typedef enum {
     NFC_REQUEST_CMD_INVALID = 0,        /* 0 / 0x0, Invalid,  For check purpose. */ 
     NFC_REQUEST_CMD_LOCK = 0xA0,        /* 160 / 0xA0, Enroll fingerpint on OTK. */ 
     NFC_REQUEST_CMD_UNLOCK,             /* 161 / 0xA1, Erase enrolled fingerprint and reset secure PIN to default, OTK (pre)authorization is required. */  
-    NFC_REQUEST_CMD_SHOW_KEY,           /* 162 / 0xA2, Present master/derivative extend keys and derivative path and secure PIN code, OTK (pre)authorization is required. */  
-    NFC_REQUEST_CMD_SIGN,               /* 163 / 0xA3, Sign external data (32 bytes hash data), taking request option: 1/Using master key, 0/Using derivated key(default), OTK (pre)authorization is required. */  
-    NFC_REQUEST_CMD_SET_KEY,            /* 164 / 0xA4, Set/chagne derivative KEY (path), OTK (pre)authorization is required. */ 
+    NFC_REQUEST_CMD_SHOW_KEY,           /* 162 / 0xA2, Present master/derivative extend keys and derivative path and secure PIN code, derivative key of slot=<n> (default 0), OTK (pre)authorization is required. */  
+    NFC_REQUEST_CMD_SIGN,               /* 163 / 0xA3, Sign external data (32 bytes hash data), taking request options: key=1/Using master key, key=0/Using derivated key(default), sig=2/Recoverable ECDSA signature, sig=1/BIP340 Schnorr signature, sig=0/ECDSA signature(default), tx=1/Data is an unsigned transaction and amounts of spent outputs, sign every input with BIP143 digest, slot=<n>/Using derivative key of slot n, 0(default) ~ KEY_SLOT_COUNT - 1, OTK (pre)authorization is required. */  
+    NFC_REQUEST_CMD_SET_KEY,            /* 164 / 0xA4, Set/chagne derivative KEY (path) of key slot selected by slot=<n> (default 0), OTK (pre)authorization is required. */ 
     NFC_REQUEST_CMD_SET_PIN,            /* 165 / 0xA5, Set/change secure PIN setting, OTK (pre)authorization is required. */ 
     NFC_REQUEST_CMD_SET_NOTE,           /* 166 / 0xA6, Set customized user note. */ 
     NFC_REQUEST_CMD_CANCEL,             /* 167 / 0xA7, Cancel previous command request. */
@@ -99,6 +156,7 @@ typedef enum {
     NFC_CMD_EXEC_NA = 0,            /* 0, Command not applicable. */ 
     NFC_CMD_EXEC_SUCCESS,           /* 1, Command executed successfully. */ 
     NFC_CMD_EXEC_FAIL,              /* 2, Command executed failed. */  
+    NFC_CMD_EXEC_BUSY,              /* 3, Command is being executed, result not ready yet. */ 
     NFC_CMD_EXEC_LAST               /* -, Not used, only for completion. */ 
 } NFC_COMMAND_EXEC_STATE;
 
@@ -149,4 +207,38 @@ OTK_Return NFC_stop(bool restart);
  * @return       OTK_Return     OTK_RETURN_OK if no error, or OTK_RETURN_FAIL otherwise
  */
 OTK_Return NFC_forceStop(void);
+
+#if (UNITTEST)
+/**
+ * @brief Execution of a request command, for unittest of batched requests.
+ * @param[in]    command        Loaded request command
+ * @param[in]    data_ptr       Loaded request data
+ * @param[in]    opt_ptr        Loaded request option
+ *
+ * @return       NFC_COMMAND_EXEC_STATE     Execution state of the command
+ */
+typedef NFC_COMMAND_EXEC_STATE (*NFC_unittestExec)(
+    NFC_REQUEST_COMMAND command,
+    const char         *data_ptr,
+    const char         *opt_ptr);
+
+/**
+ * @brief Parse records of batched commands and execute them as a batched request does, for unittest.
+ * @param[in]    command        First request command
+ * @param[in]    records        Payloads of records following the first command's option record
+ * @param[in]    recordCount    Number of records
+ * @param[in]    exec           Execution of every command, replacing real execution
+ * @param[out]   sessData_ptr   Session data written by executed commands, in text
+ * @param[in]    sessDataSize   Size of session data buffer
+ *
+ * @return       int            Number of batched commands following the first one, -1 if records are invalid.
+ */
+int NFC_runBatch(
+    NFC_REQUEST_COMMAND command,
+    char               *records[],
+    int                 recordCount,
+    NFC_unittestExec    exec,
+    char               *sessData_ptr,
+    size_t              sessDataSize);
+#endif
 #endif
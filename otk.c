@@ -59,6 +59,8 @@ static uint16_t          m_batt_lvl_in_milli_volts; //!< Current battery level.
 
 static bool m_otk_isLocked = false;
 static bool m_otk_isAuthorized = false;
+static bool m_otk_isAuthHeld = false;          /* (True), authentication is kept for batched commands. */
+static bool m_otk_isAuthClearPending = false;  /* (True), authentication is to be reset on release. */
 
 void saadc_callback(nrf_drv_saadc_evt_t const * p_event)
 {
@@ -260,9 +262,21 @@ void OTK_extend()
 }
 
 void OTK_clearAuth() {
+    if (m_otk_isAuthHeld) {
+        m_otk_isAuthClearPending = true;
+        return;
+    }
     m_otk_isAuthorized = false;
 }
 
+void OTK_holdAuth(bool hold) {
+    m_otk_isAuthHeld = hold;
+    if (!hold && m_otk_isAuthClearPending) {
+        m_otk_isAuthClearPending = false;
+        m_otk_isAuthorized = false;
+    }
+}
+
 void OTK_cease(OTK_Error err) {
     if (err == OTK_ERROR_LOW_POWER_DOWN) {
         // UART_uninit();
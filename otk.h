@@ -56,6 +56,13 @@ void OTK_extend(void);
  */
 void OTK_clearAuth(void);
 
+/* OTK_holdAuth
+ * keep OTK authentication state through OTK_clearAuth while held, for batched commands,
+ * authentication state is reset on release if OTK_clearAuth was called meanwhile.
+ */
+void OTK_holdAuth(
+	bool hold);
+
 /* OTK_cease
  * prepare for OTK shutdown
  */
@@ -93,6 +93,9 @@
 #define OTK_LABEL_REQUEST_SIG       "Request_Signature"
 #define OTK_LABEL_SESSION_SIG       "Session_Signature"
 #define OTK_LABEL_PIN_AUTH_SUSPEND  "PIN_Suspend"
+#define OTK_LABEL_TX_AMOUNT         "Transaction_Amount"
+#define OTK_LABEL_TX_FEE            "Transaction_Fee"
+#define OTK_LABEL_COMMAND_STATE     "Command_State"
 
 
 /* Return value enumeration. */
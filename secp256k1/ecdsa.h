@@ -0,0 +1,27 @@
+/**********************************************************************
+ * Copyright (c) 2013, 2014 Pieter Wuille                             *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _SECP256K1_ECDSA_
+#define _SECP256K1_ECDSA_
+
+#include <stddef.h>
+
+#include "scalar.h"
+#include "group.h"
+
+/** Create an ECDSA signature (r, s) of message with the secret key seckey using nonce, constant time.
+ *  The s value is normalized to the lower half of the group order. If recid is not NULL, the
+ *  recovery id is written to it. Returns 0 if r or s ends up zero, the caller must retry with another nonce. */
+static int secp256k1_ecdsa_sig_sign(secp256k1_scalar *r, secp256k1_scalar *s, const secp256k1_scalar *seckey, const secp256k1_scalar *message, const secp256k1_scalar *nonce, int *recid);
+
+/** Verify an ECDSA signature (r, s) of message with pubkey. Not constant time, both halves of s are accepted. */
+static int secp256k1_ecdsa_sig_verify(const secp256k1_scalar *r, const secp256k1_scalar *s, const secp256k1_ge *pubkey, const secp256k1_scalar *message);
+
+/** Recover the public key of an ECDSA signature (r, s) of message with recovery id recid (0-3).
+ *  Not constant time. Returns 0 if no public key can be recovered. */
+static int secp256k1_ecdsa_sig_recover(const secp256k1_scalar *r, const secp256k1_scalar *s, secp256k1_ge *pubkey, const secp256k1_scalar *message, int recid);
+
+#endif
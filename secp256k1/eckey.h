@@ -9,8 +9,11 @@
 
 #include <stddef.h>
 
+#include "group.h"
 #include "scalar.h"
 
+static int secp256k1_eckey_pubkey_serialize(secp256k1_ge *elem, unsigned char *pub, size_t *size, int compressed);
+
 static int secp256k1_eckey_privkey_tweak_add(secp256k1_scalar *key, const secp256k1_scalar *tweak);
 
 #endif
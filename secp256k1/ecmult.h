@@ -0,0 +1,25 @@
+/**********************************************************************
+ * Copyright (c) 2013, 2014 Pieter Wuille                             *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _SECP256K1_ECMULT_
+#define _SECP256K1_ECMULT_
+
+#include "group.h"
+#include "scalar.h"
+
+/** Window size of the precomputed odd multiples of G. The table lives in flash (ecmult_static_pre_g.h,
+ *  generated by gen_context.c) and takes ECMULT_TABLE_SIZE(WINDOW_G) * 64 bytes, regenerate it when
+ *  this is changed. wNAF digits of this window must fit in an int8_t, so it cannot exceed 8. */
+#define WINDOW_G 8
+
+/** The number of entries a table with precomputed odd multiples needs to have. */
+#define ECMULT_TABLE_SIZE(w) (1 << ((w)-2))
+
+/** Double multiply: R = na*A + ng*G. Not constant time, only for public inputs (verification).
+ *  ng can be NULL, in which case only na*A is computed. */
+static void secp256k1_ecmult(secp256k1_gej *r, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng);
+
+#endif
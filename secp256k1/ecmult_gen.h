@@ -0,0 +1,35 @@
+/**********************************************************************
+ * Copyright (c) 2013, 2014 Pieter Wuille                             *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _SECP256K1_ECMULT_GEN_
+#define _SECP256K1_ECMULT_GEN_
+
+#include "scalar.h"
+#include "group.h"
+
+/** Multiply with the generator: R = a*G. Constant time.
+ *
+ *  The precomputed comb table lives in flash (ecmult_static_context.h, generated by gen_context.c).
+ *  For accelerating the computation of a*G:
+ *  To harden against timing attacks, use the following mechanism:
+ *  * Break up the multiplicand into groups of 4 bits, called n_0, n_1, n_2, ..., n_63.
+ *  * Compute sum(n_i * 16^i * G + U_i, i=0..63), where:
+ *    * U_i = U * 2^i (for i=0..62)
+ *    * U_i = U * (1-2^63) (for i=63)
+ *    where U is a point with no known corresponding scalar. Note that sum(U_i, i=0..63) = 0.
+ *  For each i, and each of the 16 possible values of n_i, (n_i * 16^i * G + U_i) is
+ *  precomputed (call it prec(i, n_i)). The formula now becomes sum(prec(i, n_i), i=0..63).
+ *  None of the resulting prec group elements have a known scalar, and neither do any of
+ *  the intermediate sums while computing a*G.
+ */
+static void secp256k1_ecmult_gen(secp256k1_gej *r, const secp256k1_scalar *a);
+
+/** Randomize the blinding of secp256k1_ecmult_gen, the blinding value b and the projective
+ *  coordinates of bG are derived from seed32 and the prior blinding value. Without it, or
+ *  with seed32 NULL, b = 1. */
+static void secp256k1_ecmult_gen_blind(const unsigned char *seed32);
+
+#endif
@@ -0,0 +1,192 @@
+/**********************************************************************
+ * Copyright (c) 2013, 2014 Pieter Wuille                             *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _SECP256K1_ECMULT_IMPL_H_
+#define _SECP256K1_ECMULT_IMPL_H_
+
+#include <string.h>
+
+#include "group.h"
+#include "scalar.h"
+#include "ecmult.h"
+#include "ecmult_static_pre_g.h"
+
+/** Window size for na*A. Both the table of odd multiples of A and its lambda image are built
+ *  on stack for every call, so a larger window costs stack and setup time for few saved additions. */
+#define WINDOW_A 4
+
+/** Scalars are split by the endomorphism into halves of at most 128 bits, plus one digit of carry. */
+#define WNAF_BITS 130
+
+/** Fetch the odd multiple n*P from a table of odd multiples pre, negating it for negative n. */
+#define ECMULT_TABLE_GET_GE(r,pre,n,w) do { \
+    VERIFY_CHECK(((n) & 1) == 1); \
+    VERIFY_CHECK((n) >= -((1 << ((w)-1)) - 1)); \
+    VERIFY_CHECK((n) <=  ((1 << ((w)-1)) - 1)); \
+    if ((n) > 0) { \
+        *(r) = (pre)[((n)-1)/2]; \
+    } else { \
+        secp256k1_ge_neg((r), &(pre)[(-(n)-1)/2]); \
+    } \
+} while(0)
+
+#define ECMULT_TABLE_GET_GE_STORAGE(r,pre,n,w) do { \
+    VERIFY_CHECK(((n) & 1) == 1); \
+    VERIFY_CHECK((n) >= -((1 << ((w)-1)) - 1)); \
+    VERIFY_CHECK((n) <=  ((1 << ((w)-1)) - 1)); \
+    if ((n) > 0) { \
+        secp256k1_ge_from_storage((r), &(pre)[((n)-1)/2]); \
+    } else { \
+        secp256k1_ge_from_storage((r), &(pre)[(-(n)-1)/2]); \
+        secp256k1_ge_neg((r), (r)); \
+    } \
+} while(0)
+
+/** Fill a table 'pre' with precomputed odd multiples of a, pre[i] = (2*i+1)*a, in affine coordinates.
+ *  a must not be infinity. */
+static void secp256k1_ecmult_odd_multiples_table(secp256k1_ge *pre, const secp256k1_gej *a) {
+    secp256k1_gej prej[ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_gej d;
+    int i;
+
+    prej[0] = *a;
+    secp256k1_gej_double_var(&d, a);
+    for (i = 1; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
+        secp256k1_gej_add_var(&prej[i], &prej[i - 1], &d);
+    }
+    secp256k1_ge_set_table_gej_var(ECMULT_TABLE_SIZE(WINDOW_A), pre, prej);
+}
+
+/** Convert a number to WNAF notation. The number becomes represented by sum(2^i * wnaf[i], i=0..bits),
+ *  with the following guarantees:
+ *  - each wnaf[i] is either 0, or an odd integer between -(1<<(w-1) - 1) and (1<<(w-1) - 1)
+ *  - two non-zero entries in wnaf are separated by at least w-1 zeroes.
+ *  - the number of set values in wnaf is returned. This number is at most 256, and at most one more
+ *    than the number of bits in the (absolute value) of the input.
+ *  Digits are kept as int8_t, four of these arrays live on stack during a verification.
+ */
+static int secp256k1_ecmult_wnaf(int8_t *wnaf, int len, const secp256k1_scalar *a, int w) {
+    secp256k1_scalar s = *a;
+    int last_set_bit = -1;
+    int bit = 0;
+    int sign = 1;
+    int carry = 0;
+
+    VERIFY_CHECK(wnaf != NULL);
+    VERIFY_CHECK(0 <= len && len <= 256);
+    VERIFY_CHECK(a != NULL);
+    VERIFY_CHECK(2 <= w && w <= 8);
+
+    memset(wnaf, 0, len * sizeof(wnaf[0]));
+
+    if (secp256k1_scalar_get_bits(&s, 255, 1)) {
+        secp256k1_scalar_negate(&s, &s);
+        sign = -1;
+    }
+
+    while (bit < len) {
+        int now;
+        int word;
+        if (secp256k1_scalar_get_bits(&s, bit, 1) == (unsigned int)carry) {
+            bit++;
+            continue;
+        }
+
+        now = w;
+        if (now > len - bit) {
+            now = len - bit;
+        }
+
+        word = secp256k1_scalar_get_bits_var(&s, bit, now) + carry;
+
+        carry = (word >> (w-1)) & 1;
+        word -= carry << w;
+
+        wnaf[bit] = sign * word;
+        last_set_bit = bit;
+
+        bit += now;
+    }
+    VERIFY_CHECK(carry == 0);
+    return last_set_bit + 1;
+}
+
+static void secp256k1_ecmult(secp256k1_gej *r, const secp256k1_gej *a, const secp256k1_scalar *na, const secp256k1_scalar *ng) {
+    secp256k1_ge pre_a[ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_ge pre_a_lam[ECMULT_TABLE_SIZE(WINDOW_A)];
+    secp256k1_ge tmpa;
+    secp256k1_scalar na_1, na_lam;
+    secp256k1_scalar ng_1, ng_lam;
+    int8_t wnaf_na_1[WNAF_BITS];
+    int8_t wnaf_na_lam[WNAF_BITS];
+    int8_t wnaf_ng_1[WNAF_BITS];
+    int8_t wnaf_ng_lam[WNAF_BITS];
+    int bits_na_1 = 0;
+    int bits_na_lam = 0;
+    int bits_ng_1 = 0;
+    int bits_ng_lam = 0;
+    int bits = 0;
+    int i;
+    int n;
+
+    /* Strauss: all four half-length scalars share one run of doublings. */
+    if (!a->infinity && !secp256k1_scalar_is_zero(na)) {
+        /* split na into na_1 and na_lam (where na = na_1 + na_lam*lambda, and na_1 and na_lam are ~128 bit) */
+        secp256k1_scalar_split_lambda(&na_1, &na_lam, na);
+        bits_na_1 = secp256k1_ecmult_wnaf(wnaf_na_1, WNAF_BITS, &na_1, WINDOW_A);
+        bits_na_lam = secp256k1_ecmult_wnaf(wnaf_na_lam, WNAF_BITS, &na_lam, WINDOW_A);
+        VERIFY_CHECK(bits_na_1 <= WNAF_BITS);
+        VERIFY_CHECK(bits_na_lam <= WNAF_BITS);
+
+        /* calculate odd multiples of a and their lambda images */
+        secp256k1_ecmult_odd_multiples_table(pre_a, a);
+        for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_A); i++) {
+            secp256k1_ge_mul_lambda(&pre_a_lam[i], &pre_a[i]);
+        }
+        bits = bits_na_1 > bits_na_lam ? bits_na_1 : bits_na_lam;
+    }
+
+    if (ng != NULL) {
+        /* split ng the same way, the lambda image of the G table is taken on the fly */
+        secp256k1_scalar_split_lambda(&ng_1, &ng_lam, ng);
+        bits_ng_1 = secp256k1_ecmult_wnaf(wnaf_ng_1, WNAF_BITS, &ng_1, WINDOW_G);
+        bits_ng_lam = secp256k1_ecmult_wnaf(wnaf_ng_lam, WNAF_BITS, &ng_lam, WINDOW_G);
+        if (bits_ng_1 > bits) {
+            bits = bits_ng_1;
+        }
+        if (bits_ng_lam > bits) {
+            bits = bits_ng_lam;
+        }
+    }
+
+    secp256k1_gej_set_infinity(r);
+
+    for (i = bits - 1; i >= 0; i--) {
+        secp256k1_gej_double_var(r, r);
+        if (i < bits_na_1 && (n = wnaf_na_1[i])) {
+            ECMULT_TABLE_GET_GE(&tmpa, pre_a, n, WINDOW_A);
+            secp256k1_gej_add_ge_var(r, r, &tmpa);
+        }
+        if (i < bits_na_lam && (n = wnaf_na_lam[i])) {
+            ECMULT_TABLE_GET_GE(&tmpa, pre_a_lam, n, WINDOW_A);
+            secp256k1_gej_add_ge_var(r, r, &tmpa);
+        }
+        if (i < bits_ng_1 && (n = wnaf_ng_1[i])) {
+            ECMULT_TABLE_GET_GE_STORAGE(&tmpa, secp256k1_ecmult_static_pre_g, n, WINDOW_G);
+            secp256k1_gej_add_ge_var(r, r, &tmpa);
+        }
+        if (i < bits_ng_lam && (n = wnaf_ng_lam[i])) {
+            ECMULT_TABLE_GET_GE_STORAGE(&tmpa, secp256k1_ecmult_static_pre_g, n, WINDOW_G);
+            secp256k1_ge_mul_lambda(&tmpa, &tmpa);
+            secp256k1_gej_add_ge_var(r, r, &tmpa);
+        }
+    }
+}
+
+#undef WINDOW_A
+#undef WNAF_BITS
+
+#endif
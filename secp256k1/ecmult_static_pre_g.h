@@ -0,0 +1,77 @@
+#ifndef _SECP256K1_ECMULT_STATIC_PRE_G_
+#define _SECP256K1_ECMULT_STATIC_PRE_G_
+/* Generated by gen_context.c, do not edit. */
+#include "group.h"
+#include "ecmult.h"
+#if WINDOW_G != 8
+#error "WINDOW_G changed, regenerate ecmult_static_pre_g.h with gen_context.c"
+#endif
+#define SC SECP256K1_GE_STORAGE_CONST
+static const secp256k1_ge_storage secp256k1_ecmult_static_pre_g[ECMULT_TABLE_SIZE(WINDOW_G)] = {
+    SC(2042521214u, 4191992748u, 1436574357u, 3464956679u, 43777243u, 768485593u, 1509065051u, 385357720u, 1211816567u, 648266853u, 1571093500u, 235997352u, 4246189128u, 2793755673u, 2621952143u, 4212184248u),
+    SC(4180707841u, 2455290640u, 1228164997u, 4171059753u, 3039938629u, 2205129136u, 2248274195u, 3168810745u, 948927247u, 1663952916u, 266549222u, 708309846u, 1694542233u, 885138203u, 1824128373u, 2226710130u),
+    SC(797695565u, 436674707u, 1437902629u, 173822248u, 3901457597u, 3697384119u, 3416839529u, 2990600164u, 3635159590u, 921035734u, 3571165661u, 2798240806u, 4152895259u, 2869782592u, 3702029626u, 2796315350u),
+    SC(1555951716u, 1851634922u, 2744709989u, 4075452942u, 1027709822u, 53535644u, 3911966189u, 3401906620u, 1793837632u, 3123009888u, 2736229741u, 2249872603u, 2819870904u, 335407029u, 2768774696u, 141714650u),
+    SC(2899608802u, 4039636563u, 162338698u, 2673187517u, 3768030871u, 1280829204u, 3277787405u, 4230466750u, 3425929505u, 2963790333u, 1681394033u, 1983603177u, 2916649124u, 929009167u, 97265194u, 3327106103u),
+    SC(2001397752u, 1487487262u, 1593058411u, 1892047532u, 1447663627u, 3854661777u, 3152811913u, 1570769099u, 3649347634u, 3949682201u, 38002006u, 3619140453u, 925741538u, 3757692584u, 807236809u, 3377710619u),
+    SC(4068963266u, 3648333963u, 3352416773u, 3279193681u, 2960522182u, 1628330189u, 3740131215u, 423647912u, 179343406u, 2374503049u, 1971458795u, 1707978567u, 974784218u, 1377806623u, 699779922u, 3674467713u),
+    SC(3616689487u, 2101602966u, 1514560227u, 157283345u, 837129327u, 1015412638u, 1152236792u, 3799910414u, 1478371442u, 2825679526u, 2206478018u, 684486127u, 3930107691u, 3633763237u, 3305430175u, 4137839448u),
+    SC(3741182540u, 3680991056u, 2753625832u, 132828961u, 3952646318u, 2042197639u, 1726282400u, 1244482100u, 1108454150u, 2489536872u, 3919032554u, 3534306734u, 3469866144u, 1251328246u, 3484522998u, 2656496503u),
+    SC(726573223u, 2544124882u, 2481937663u, 1146046841u, 4033531883u, 3622333735u, 1953850721u, 943217516u, 2246613952u, 932470163u, 3007514683u, 1511818771u, 436336140u, 1344706403u, 3044067412u, 3854605178u),
+    SC(892059466u, 1289556566u, 1335097907u, 753087280u, 496686082u, 1912082545u, 2167671535u, 633231829u, 840872967u, 1397290292u, 3583776805u, 2648325663u, 1243298606u, 1907426204u, 1740455307u, 3481377164u),
+    SC(799150157u, 1798885659u, 36700421u, 1502056740u, 3828005087u, 4025876265u, 3701267165u, 1321913407u, 48107624u, 694016101u, 3058002227u, 1540742528u, 404582636u, 4236781128u, 1111205739u, 1395359079u),
+    SC(2454202267u, 162846349u, 2871110064u, 1726864003u, 641482116u, 3767890658u, 1774849239u, 4114954004u, 1929473915u, 4063537886u, 1562027803u, 3735204351u, 1069604394u, 2289636095u, 3846845134u, 2546676738u),
+    SC(3672985387u, 3819487015u, 2389709615u, 2965288786u, 794234388u, 1274418624u, 2123984196u, 1039042345u, 2795359818u, 2104269032u, 3567365288u, 2130237184u, 1065599536u, 4088375078u, 2873156898u, 2428378197u),
+    SC(3293385415u, 106791214u, 2328832215u, 3417415568u, 300734953u, 4260528560u, 3869488616u, 2099439579u, 555328608u, 3459411164u, 1992579366u, 3380805036u, 235957894u, 517956037u, 2688091711u, 235824258u),
+    SC(1780767734u, 3697902852u, 3365544143u, 3738568787u, 355166547u, 918716515u, 3055314379u, 3530155700u, 3760377666u, 3267185264u, 2336182566u, 4050265261u, 2335423048u, 3494001518u, 4250821448u, 269322882u),
+    SC(379060134u, 4254983719u, 3229082578u, 4266922116u, 3457363979u, 200020294u, 4183483775u, 218879653u, 3116603633u, 2256564061u, 659952902u, 3830805555u, 2731480320u, 2655619815u, 2918096227u, 3491439510u),
+    SC(1616632577u, 2575397259u, 2557284103u, 3895773965u, 2649457504u, 4290246173u, 4186059870u, 4068111481u, 43461933u, 3841511942u, 2175241619u, 3969318435u, 3261856488u, 1337019828u, 989979113u, 90934345u),
+    SC(1657884075u, 1095810889u, 1946353092u, 1512136208u, 3702529077u, 1230614796u, 4264675305u, 3632263997u, 2164000445u, 2361765904u, 2550696473u, 1357828315u, 27923241u, 1739278114u, 905274404u, 2209504943u),
+    SC(2160462544u, 68102106u, 3730524934u, 3288917355u, 743500277u, 1805355842u, 1582652463u, 2251328367u, 473444415u, 482722575u, 652635053u, 2145857392u, 2791238988u, 3195020523u, 446701398u, 1124849018u),
+    SC(2056484269u, 1634184532u, 2859779636u, 2361740596u, 1288035476u, 2279098116u, 2640227248u, 4194552059u, 219037609u, 3970462313u, 156605965u, 2032570438u, 3183845025u, 208719403u, 47487468u, 575522807u),
+    SC(3576229081u, 3063330124u, 2423955152u, 1162115705u, 3141570243u, 2607341392u, 1270161221u, 2613313481u, 4006560037u, 825681401u, 2573660696u, 2180867438u, 3158525248u, 1548881340u, 104097205u, 557881651u),
+    SC(76771492u, 3052680210u, 3928356116u, 3907836624u, 1382420830u, 1249823507u, 2267224072u, 4172568931u, 1972322113u, 2950098242u, 2335211952u, 1362089514u, 1422128047u, 3143329636u, 3058894122u, 311729306u),
+    SC(2012360851u, 1860734139u, 3611162928u, 3594978031u, 2283634974u, 236230882u, 4055973553u, 4231290228u, 2509173802u, 2022094400u, 168306286u, 2611065720u, 2529776432u, 3648026571u, 3197023175u, 1729913046u),
+    SC(4074424721u, 3427591353u, 3930359934u, 1551633358u, 1489502324u, 2879212986u, 3945288475u, 2000287024u, 3772701851u, 992972205u, 1302459181u, 3961860575u, 2662726635u, 93906173u, 437353914u, 1882864695u),
+    SC(1178287519u, 1713775099u, 457959675u, 3190104082u, 1512139999u, 3386565598u, 3166324816u, 3331380315u, 1590964439u, 2351524917u, 1125204742u, 3716555479u, 3324174972u, 2534022627u, 481523632u, 452407422u),
+    SC(4050616386u, 1155821098u, 153300298u, 4282079639u, 1805187777u, 1126736593u, 2737084084u, 2576937543u, 3470441883u, 2183151486u, 332531452u, 3746444249u, 711742402u, 1851575846u, 3596065122u, 3303218678u),
+    SC(3405206567u, 768099683u, 2956274554u, 338762485u, 1562661653u, 2900524133u, 916329975u, 354238929u, 3410445920u, 4013290994u, 2753258559u, 2783207511u, 1599056311u, 2518823589u, 3274674307u, 413156470u),
+    SC(637585995u, 674019718u, 4166848279u, 160931211u, 1151376391u, 3414611905u, 608795592u, 1862803744u, 1092204679u, 1405180886u, 2794696767u, 3453727837u, 1522974324u, 2875133684u, 1259071815u, 1518226240u),
+    SC(1983236722u, 3622322988u, 864994620u, 3508674748u, 29656709u, 3796860360u, 3322062708u, 1771627573u, 152790166u, 155753825u, 1025334873u, 259581655u, 1322238049u, 3580905658u, 3655823152u, 744201313u),
+    SC(1968058937u, 4079310604u, 3686746759u, 3740174950u, 3086136116u, 2043963643u, 3248817987u, 3210136600u, 108264326u, 3854410511u, 3016560339u, 82463136u, 602813392u, 427452765u, 207460361u, 1012098691u),
+    SC(3823549712u, 1906436458u, 4283925916u, 2195026160u, 856162406u, 488412463u, 2682415430u, 2446965224u, 1506402491u, 2744444783u, 1086368344u, 932854966u, 2778867769u, 2481523777u, 1728064244u, 2450405365u),
+    SC(409684029u, 90833720u, 648967128u, 2406689157u, 3301749235u, 732127051u, 1287946204u, 4031424235u, 999632178u, 3330078590u, 773276782u, 541163691u, 570130576u, 2303801524u, 2762446840u, 1853917323u),
+    SC(3751637158u, 3112660197u, 1154057569u, 4106112882u, 1413670610u, 3073890761u, 444801394u, 1289786943u, 1441476015u, 3628952781u, 1602628472u, 1573100874u, 2975277607u, 552574370u, 397984860u, 4072285207u),
+    SC(1591565506u, 1012000890u, 1232906261u, 3588022520u, 2874299727u, 2225002649u, 1575373919u, 885944643u, 4021197965u, 3155432198u, 1642647232u, 818453200u, 3241961152u, 3514444037u, 3452372651u, 1939449960u),
+    SC(688363714u, 3058133040u, 3658677762u, 679386743u, 2057567137u, 3277173114u, 1915565615u, 2220969914u, 3817711469u, 3443787297u, 2559377596u, 4154126941u, 1529462932u, 3676971796u, 1828731645u, 1100234362u),
+    SC(2939961914u, 2514089395u, 88560879u, 2706418745u, 3442038063u, 3814729075u, 1658838734u, 4093983557u, 4186587096u, 837495668u, 2593370342u, 4082957120u, 3368901286u, 1738626433u, 3157257709u, 1234164166u),
+    SC(1986902820u, 3509905221u, 3435831948u, 2579441481u, 112944818u, 1842321631u, 2368728400u, 3632538778u, 1951076690u, 3939231203u, 2378991737u, 2161785016u, 2539145829u, 4194750173u, 747786135u, 3417069974u),
+    SC(1507587183u, 2358539675u, 2719119299u, 931460118u, 1173861455u, 1817799256u, 3465733734u, 421183038u, 3308563780u, 392150064u, 256812750u, 1686309280u, 1120826266u, 2031712652u, 3630047596u, 1244692334u),
+    SC(4047166101u, 272385335u, 811493662u, 1961469096u, 3714350705u, 446031676u, 3056453121u, 2365425592u, 3778549684u, 1323388390u, 1673481160u, 137633586u, 1766449690u, 1786102359u, 125321627u, 3673518909u),
+    SC(2002040058u, 243977936u, 1833002914u, 3315386956u, 3659033024u, 1857740726u, 1216696321u, 1518883372u, 820592262u, 1315347842u, 575379068u, 807450874u, 2367573557u, 191675589u, 933530455u, 2215732130u),
+    SC(2492320479u, 1502666824u, 2855826644u, 1790900695u, 25530261u, 3732947410u, 2793573529u, 3794150681u, 3834749989u, 938927511u, 3587344946u, 615627813u, 3750843631u, 3173970386u, 3417975982u, 1397216638u),
+    SC(2036482372u, 1355246614u, 2311566479u, 2181229623u, 4213329141u, 2886466069u, 1882360458u, 1031567275u, 269181198u, 3305092214u, 224141249u, 871329643u, 307264005u, 520399959u, 1622123954u, 2646094903u),
+    SC(890505336u, 882264916u, 2975536646u, 1155077448u, 1511430002u, 632849531u, 2967275601u, 938231754u, 4010474418u, 90309956u, 2383827652u, 2390829052u, 1614407548u, 365049739u, 2122126752u, 3727242001u),
+    SC(3553374381u, 1799896651u, 3348947657u, 3716924745u, 2481539051u, 2381809588u, 1117011263u, 2069003951u, 2335672866u, 3626444685u, 2311449022u, 2408908974u, 1009439842u, 2419426864u, 2947763632u, 1324212388u),
+    SC(371513415u, 2155030624u, 3457972476u, 3220168843u, 724140605u, 3105093193u, 964016655u, 4102321680u, 1751457017u, 3067777086u, 152323212u, 1826215114u, 2305325301u, 673965256u, 3423003300u, 67601781u),
+    SC(1933371405u, 2840963234u, 1761790294u, 870722200u, 1368541003u, 1525811162u, 1844950269u, 1606819028u, 4114831915u, 3535462269u, 1213877643u, 2377776334u, 1042217184u, 538854776u, 3309728700u, 499509789u),
+    SC(366560274u, 1419006052u, 3474594867u, 3151213727u, 2305213705u, 561112729u, 4012215802u, 3088843868u, 3580801803u, 1766211186u, 888476539u, 1941455223u, 1128792250u, 3468674693u, 4231511017u, 4024698637u),
+    SC(2714828018u, 3969771125u, 3054637934u, 1558646055u, 471941500u, 2636876458u, 2886960537u, 3497097536u, 3990323024u, 3166020554u, 3001616183u, 815163378u, 1679057573u, 1081144277u, 421604665u, 3247941161u),
+    SC(3794779669u, 3232730316u, 1468055667u, 1602542569u, 2811280094u, 3894696966u, 3351918387u, 481520000u, 176511915u, 2908542476u, 2293510310u, 2673058215u, 2743240981u, 1231321499u, 3829204695u, 2100419078u),
+    SC(823169501u, 2556487906u, 249640051u, 3239403359u, 1768119865u, 1191504551u, 1074349346u, 1188014515u, 1725654383u, 2278682703u, 4291948615u, 2294310960u, 2266940838u, 1341056645u, 3179344049u, 678265716u),
+    SC(885128452u, 3540106889u, 3004957762u, 3555109924u, 2285447348u, 1519599736u, 409457699u, 784522207u, 155272837u, 3917159257u, 1421690615u, 806830390u, 3581877486u, 3028763709u, 3308394583u, 3128142830u),
+    SC(4061784669u, 1800695836u, 471129691u, 1434367018u, 2366895019u, 3167783679u, 3425328747u, 77303139u, 1287215447u, 3896328368u, 4147835988u, 1288500913u, 4105211196u, 129138616u, 3636631082u, 1074226897u),
+    SC(3619189775u, 1957231530u, 2985722843u, 2403720742u, 1413108880u, 3165005576u, 1916178724u, 1772139592u, 4202141313u, 685361454u, 3774943027u, 2060743038u, 4279622494u, 3552594355u, 1092485909u, 3936639291u),
+    SC(852696098u, 797929230u, 4168055960u, 3550688094u, 2908474674u, 2883425320u, 2682573577u, 447227071u, 1596994293u, 2300663523u, 2630696313u, 364503514u, 778939550u, 1864821089u, 294458552u, 1177425505u),
+    SC(1952576369u, 2437591846u, 1896110613u, 1570255338u, 2274613116u, 3583349444u, 873432779u, 3246606261u, 2394995235u, 2341912256u, 3420314798u, 178537044u, 787357685u, 211316390u, 3013101491u, 3423154166u),
+    SC(3993475803u, 502367744u, 1949657637u, 2855805034u, 1836149548u, 1046955325u, 678860986u, 3618812630u, 2378318122u, 2950938204u, 1281308640u, 3972397558u, 2756090010u, 4031532581u, 3953837177u, 3961293854u),
+    SC(384603108u, 1206682608u, 1182472240u, 786833655u, 3864912689u, 2269945287u, 738035222u, 3130894005u, 1581658389u, 241367872u, 3504915111u, 3394765987u, 2639796330u, 1357158163u, 2519103374u, 632317773u),
+    SC(3936745856u, 3259365104u, 949453456u, 2946960235u, 3632617623u, 4186663588u, 2243518565u, 3577200025u, 4133444926u, 690761224u, 430254137u, 479807012u, 3615786653u, 2121180799u, 2977972482u, 1323042780u),
+    SC(126653447u, 1414185266u, 1764680081u, 167920537u, 1487799431u, 1901147182u, 2842446699u, 899981137u, 4091556241u, 1777048453u, 3577759637u, 1402625640u, 4196384088u, 1007045924u, 1656124913u, 2493767092u),
+    SC(1229933538u, 430024560u, 383572024u, 1125837312u, 30263470u, 2054145672u, 1919252697u, 1881692069u, 1109666454u, 2458101235u, 968523527u, 1580644906u, 4180004400u, 3613912430u, 1442099249u, 2282575404u),
+    SC(2778245123u, 229038188u, 1808265973u, 340698441u, 3531739626u, 1492821774u, 3209436774u, 1545595317u, 541810031u, 2223123504u, 2118863473u, 1081309932u, 603743158u, 1530263658u, 268594621u, 763776619u),
+    SC(3289978422u, 1522215773u, 152645471u, 767471596u, 546243087u, 307694104u, 1304091710u, 1482250647u, 82920273u, 3490217722u, 1238517171u, 681068937u, 3586849093u, 255115200u, 3977701739u, 1492818195u),
+    SC(2216517731u, 2777086535u, 1517438468u, 3657677915u, 2460147922u, 3768806095u, 3838261845u, 343156865u, 121137141u, 2617661928u, 419756449u, 3344184984u, 3861209814u, 1951143580u, 3886247392u, 445473108u)
+};
+#undef SC
+#endif
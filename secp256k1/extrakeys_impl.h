@@ -0,0 +1,50 @@
+/**********************************************************************
+ * Copyright (c) 2020 Jonas Nick                                      *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+#ifndef _SECP256K1_EXTRAKEYS_IMPL_H_
+#define _SECP256K1_EXTRAKEYS_IMPL_H_
+
+#include "secp256k1_extrakeys.h"
+
+static SECP256K1_INLINE int secp256k1_xonly_pubkey_load(secp256k1_ge *ge, const secp256k1_xonly_pubkey *pubkey) {
+    return secp256k1_pubkey_load(ge, (const secp256k1_pubkey *) pubkey);
+}
+
+int secp256k1_xonly_pubkey_parse(const secp256k1_context* ctx, secp256k1_xonly_pubkey *pubkey, const unsigned char *input32) {
+    secp256k1_ge pk;
+    secp256k1_fe x;
+
+    (void)ctx;
+    memset(pubkey, 0, sizeof(*pubkey));
+    if (!secp256k1_fe_set_b32(&x, input32)) {
+        return 0;
+    }
+    if (!secp256k1_ge_set_xo_var(&pk, &x, 0)) {
+        return 0;
+    }
+    secp256k1_pubkey_save((secp256k1_pubkey *) pubkey, &pk);
+    return 1;
+}
+
+/* Keypair layout: 32-byte secret key followed by the public key in secp256k1_pubkey representation. */
+static int secp256k1_keypair_load(secp256k1_scalar *sk, secp256k1_ge *pk, const secp256k1_keypair *keypair) {
+    int overflow;
+
+    secp256k1_scalar_set_b32(sk, &keypair->data[0], &overflow);
+    secp256k1_pubkey_load(pk, (const secp256k1_pubkey *)&keypair->data[32]);
+    return !overflow && !secp256k1_scalar_is_zero(sk);
+}
+
+int secp256k1_keypair_create(const secp256k1_context* ctx, secp256k1_keypair *keypair, const unsigned char *seckey) {
+    memset(keypair, 0, sizeof(*keypair));
+    if (!secp256k1_ec_pubkey_create(ctx, (secp256k1_pubkey *)&keypair->data[32], seckey)) {
+        return 0;
+    }
+    memcpy(&keypair->data[0], seckey, 32);
+    return 1;
+}
+
+#endif
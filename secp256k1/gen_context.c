@@ -0,0 +1,143 @@
+/**********************************************************************
+ * Copyright (c) 2013, 2014, 2015 Thomas Daede, Cory Fields           *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/*
+ * Host tool generating the precomputed comb table of secp256k1_ecmult_gen and
+ * the odd multiples of G used by secp256k1_ecmult.
+ * It is not part of the firmware image, build and run it on the host when
+ * ecmult_static_context.h or ecmult_static_pre_g.h has to be regenerated:
+ *
+ *   gcc -DUSE_FIELD_10X26 -DUSE_SCALAR_8X32 -o gen_context gen_context.c && ./gen_context
+ */
+
+#define SECP256K1_BUILD (1)
+
+#include <stdio.h>
+#include <string.h>
+
+#include "secp256k1.h"
+#include "util.h"
+#include "field_impl.h"
+#include "scalar_impl.h"
+#include "group_impl.h"
+#include "ecmult.h"
+
+int main(int argc, char **argv) {
+    static secp256k1_gej precj[1024]; /* Jacobian versions of prec. */
+    static const unsigned char nums_b32[33] = "The scalar for this x is unknown";
+    secp256k1_fe nums_x;
+    secp256k1_ge nums_ge;
+    secp256k1_gej nums_gej;
+    secp256k1_gej gbase;
+    secp256k1_gej numsbase;
+    secp256k1_ge gbase_ge;
+    static secp256k1_gej pre_gj[ECMULT_TABLE_SIZE(WINDOW_G)];
+    secp256k1_gej g2;
+    secp256k1_ge_storage prec;
+    secp256k1_ge ge;
+    int i, j;
+    FILE* fp;
+
+    (void)argc;
+    (void)argv;
+
+    /* Construct a group element with no known corresponding scalar (nothing up my sleeve). */
+    if (!secp256k1_fe_set_b32(&nums_x, nums_b32) || !secp256k1_ge_set_xo_var(&nums_ge, &nums_x, 0)) {
+        fprintf(stderr, "Could not construct nums point!\n");
+        return -1;
+    }
+    secp256k1_gej_set_ge(&nums_gej, &nums_ge);
+    /* Add G to make the bits in x uniformly distributed. */
+    secp256k1_gej_add_ge_var(&nums_gej, &nums_gej, &secp256k1_ge_const_g);
+
+    /* Compute prec. */
+    secp256k1_gej_set_ge(&gbase, &secp256k1_ge_const_g); /* 16^j * G */
+    numsbase = nums_gej; /* 2^j * nums. */
+    for (j = 0; j < 64; j++) {
+        /* Set precj[j*16 .. j*16+15] to (numsbase, numsbase + gbase, ..., numsbase + 15*gbase). */
+        precj[j*16] = numsbase;
+        secp256k1_ge_set_gej_var(&gbase_ge, &gbase);
+        for (i = 1; i < 16; i++) {
+            secp256k1_gej_add_ge_var(&precj[j*16 + i], &precj[j*16 + i - 1], &gbase_ge);
+        }
+        /* Multiply gbase by 16. */
+        for (i = 0; i < 4; i++) {
+            secp256k1_gej_double_var(&gbase, &gbase);
+        }
+        /* Multiply numbase by 2. */
+        secp256k1_gej_double_var(&numsbase, &numsbase);
+        if (j == 62) {
+            /* In the last iteration, numsbase is (1 - 2^j) * nums instead. */
+            secp256k1_gej_neg(&numsbase, &numsbase);
+            secp256k1_gej_add_var(&numsbase, &numsbase, &nums_gej);
+        }
+    }
+
+    fp = fopen("ecmult_static_context.h", "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open ecmult_static_context.h for writing!\n");
+        return -1;
+    }
+
+    fprintf(fp, "#ifndef _SECP256K1_ECMULT_STATIC_CONTEXT_\n");
+    fprintf(fp, "#define _SECP256K1_ECMULT_STATIC_CONTEXT_\n");
+    fprintf(fp, "/* Generated by gen_context.c, do not edit. */\n");
+    fprintf(fp, "#include \"group.h\"\n");
+    fprintf(fp, "#define SC SECP256K1_GE_STORAGE_CONST\n");
+    fprintf(fp, "static const secp256k1_ge_storage secp256k1_ecmult_static_context[64][16] = {\n");
+    for (j = 0; j < 64; j++) {
+        fprintf(fp, "{\n");
+        for (i = 0; i < 16; i++) {
+            secp256k1_ge_set_gej(&ge, &precj[j*16 + i]);
+            secp256k1_ge_to_storage(&prec, &ge);
+            fprintf(fp, "    SC(%uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu)",
+                    SECP256K1_GE_STORAGE_CONST_GET(prec));
+            fprintf(fp, i != 15 ? ",\n" : "\n");
+        }
+        fprintf(fp, j != 63 ? "},\n" : "}\n");
+    }
+    fprintf(fp, "};\n");
+    fprintf(fp, "#undef SC\n");
+    fprintf(fp, "#endif\n");
+    fclose(fp);
+
+    /* Compute odd multiples of G, pre_gj[i] = (2*i+1)*G. */
+    secp256k1_gej_set_ge(&pre_gj[0], &secp256k1_ge_const_g);
+    secp256k1_gej_double_var(&g2, &pre_gj[0]);
+    for (i = 1; i < ECMULT_TABLE_SIZE(WINDOW_G); i++) {
+        secp256k1_gej_add_var(&pre_gj[i], &pre_gj[i - 1], &g2);
+    }
+
+    fp = fopen("ecmult_static_pre_g.h", "w");
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open ecmult_static_pre_g.h for writing!\n");
+        return -1;
+    }
+
+    fprintf(fp, "#ifndef _SECP256K1_ECMULT_STATIC_PRE_G_\n");
+    fprintf(fp, "#define _SECP256K1_ECMULT_STATIC_PRE_G_\n");
+    fprintf(fp, "/* Generated by gen_context.c, do not edit. */\n");
+    fprintf(fp, "#include \"group.h\"\n");
+    fprintf(fp, "#include \"ecmult.h\"\n");
+    fprintf(fp, "#if WINDOW_G != %d\n", WINDOW_G);
+    fprintf(fp, "#error \"WINDOW_G changed, regenerate ecmult_static_pre_g.h with gen_context.c\"\n");
+    fprintf(fp, "#endif\n");
+    fprintf(fp, "#define SC SECP256K1_GE_STORAGE_CONST\n");
+    fprintf(fp, "static const secp256k1_ge_storage secp256k1_ecmult_static_pre_g[ECMULT_TABLE_SIZE(WINDOW_G)] = {\n");
+    for (i = 0; i < ECMULT_TABLE_SIZE(WINDOW_G); i++) {
+        secp256k1_ge_set_gej(&ge, &pre_gj[i]);
+        secp256k1_ge_to_storage(&prec, &ge);
+        fprintf(fp, "    SC(%uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu, %uu)",
+                SECP256K1_GE_STORAGE_CONST_GET(prec));
+        fprintf(fp, i != ECMULT_TABLE_SIZE(WINDOW_G) - 1 ? ",\n" : "\n");
+    }
+    fprintf(fp, "};\n");
+    fprintf(fp, "#undef SC\n");
+    fprintf(fp, "#endif\n");
+    fclose(fp);
+
+    return 0;
+}
@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <stdint.h>
+#include "nrf.h"
 #include "sdk_common.h"
 #include "nrf_assert.h"
 #include "nrf_log.h"
@@ -29,14 +30,146 @@
 #include "mem_manager.h"
 #include "nrf_crypto_ecc.h"
 #include "mbedtls/ripemd160.h"
+#include "secp256k1/secp256k1.h"
+#include "libbtc/sha2.h"
+#include "libbtc/base58.h"
+#include "libbtc/hash.h"
+#include "libbtc/strwriter.h"
+#include "libbtc/hashwriter.h"
+#include "libbtc/sighash.h"
+#include "libbtc/utils.h"
 
 #include "otk.h"
+#include "key.h"
+#include "nfc.h"
 
 static CRYPTO_seed seed1 = {
     .octets = {
     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f}
 };
 
+/* BIP32 test vector 2. */
+static CRYPTO_seed seed2 = {
+    .octets = {
+    0xff, 0xfc, 0xf9, 0xf6, 0xf3, 0xf0, 0xed, 0xea, 0xe7, 0xe4, 0xe1, 0xde, 0xdb, 0xd8, 0xd5, 0xd2,
+    0xcf, 0xcc, 0xc9, 0xc6, 0xc3, 0xc0, 0xbd, 0xba, 0xb7, 0xb4, 0xb1, 0xae, 0xab, 0xa8, 0xa5, 0xa2,
+    0x9f, 0x9c, 0x99, 0x96, 0x93, 0x90, 0x8d, 0x8a, 0x87, 0x84, 0x81, 0x7e, 0x7b, 0x78, 0x75, 0x72,
+    0x6f, 0x6c, 0x69, 0x66, 0x63, 0x60, 0x5d, 0x5a, 0x57, 0x54, 0x51, 0x4e, 0x4b, 0x48, 0x45, 0x42}
+};
+
+/* BIP32 test vector 2, hash160 (identifier) of master public key. */
+static const uint8_t seed2MasterHash160[] = {
+    0xbd, 0x16, 0xbe, 0xe5, 0x39, 0x61, 0xa4, 0x7d, 0x6a, 0xd8,
+    0x88, 0xe2, 0x95, 0x45, 0x43, 0x4a, 0x89, 0xbd, 0xfe, 0x95};
+
+static const char seed2ExtPublicKey[] =
+    "xpub661MyMwAqRbcFW31YEwpkMuc5THy2PSt5bDMsktWQcFF8syAmRUapSCGu8ED9W6oDMSgv6Zz8idoc4a6mr8BDzTJY47LJhkJ8UB7WEGuduB";
+
+/* RFC6979 ECDSA vector, private key 1 signs SHA256("Satoshi Nakamoto"). */
+static CRYPTO_privateKey rfc6979PrivateKey = {
+    .octets = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}
+};
+
+static const uint8_t rfc6979Hash[] = {
+    0xa0, 0xdc, 0x65, 0xff, 0xca, 0x79, 0x98, 0x73, 0xcb, 0xea, 0x0a, 0xc2, 0x74, 0x01, 0x5b, 0x95,
+    0x26, 0x50, 0x5d, 0xaa, 0xae, 0xd3, 0x85, 0x15, 0x54, 0x25, 0xf7, 0x33, 0x77, 0x04, 0x88, 0x3e,
+};
+
+static const uint8_t rfc6979Signature[] = {
+    0x93, 0x4b, 0x1e, 0xa1, 0x0a, 0x4b, 0x3c, 0x17, 0x57, 0xe2, 0xb0, 0xc0, 0x17, 0xd0, 0xb6, 0x14,
+    0x3c, 0xe3, 0xc9, 0xa7, 0xe6, 0xa4, 0xa4, 0x98, 0x60, 0xd7, 0xa6, 0xab, 0x21, 0x0e, 0xe3, 0xd8,
+    0x24, 0x42, 0xce, 0x9d, 0x2b, 0x91, 0x60, 0x64, 0x10, 0x80, 0x14, 0x78, 0x3e, 0x92, 0x3e, 0xc3,
+    0x6b, 0x49, 0x74, 0x3e, 0x2f, 0xfa, 0x1c, 0x44, 0x96, 0xf0, 0x1a, 0x51, 0x2a, 0xaf, 0xd9, 0xe5,
+};
+
+/* Public key of private key 1, the generator point. */
+static CRYPTO_publicKey rfc6979PublicKey = {
+    .octets = {
+    0x02, 0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac, 0x55, 0xa0, 0x62, 0x95, 0xce, 0x87, 0x0b,
+    0x07, 0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9, 0x59, 0xf2, 0x81, 0x5b, 0x16, 0xf8, 0x17,
+    0x98}
+};
+
+/* BIP340 test vectors 0 and 1, public key is the x-only key with an even prefix. */
+typedef struct {
+    CRYPTO_privateKey privateKey;
+    CRYPTO_publicKey  publicKey;
+    uint8_t           auxRand[CRYPTO_HASH_SZ];
+    uint8_t           hash[CRYPTO_HASH_SZ];
+    CRYPTO_signature  signature;
+} unittest_bip340Vector;
+
+static const unittest_bip340Vector bip340Vectors[] = {
+    {
+        .privateKey = {.octets = {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        }},
+        .publicKey = {.octets = {
+            0x02,
+            0xf9, 0x30, 0x8a, 0x01, 0x92, 0x58, 0xc3, 0x10, 0x49, 0x34, 0x4f, 0x85, 0xf8, 0x9d, 0x52, 0x29,
+            0xb5, 0x31, 0xc8, 0x45, 0x83, 0x6f, 0x99, 0xb0, 0x86, 0x01, 0xf1, 0x13, 0xbc, 0xe0, 0x36, 0xf9,
+        }},
+        .auxRand = {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        .hash = {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        .signature = {.octets = {
+            0xe9, 0x07, 0x83, 0x1f, 0x80, 0x84, 0x8d, 0x10, 0x69, 0xa5, 0x37, 0x1b, 0x40, 0x24, 0x10, 0x36,
+            0x4b, 0xdf, 0x1c, 0x5f, 0x83, 0x07, 0xb0, 0x08, 0x4c, 0x55, 0xf1, 0xce, 0x2d, 0xca, 0x82, 0x15,
+            0x25, 0xf6, 0x6a, 0x4a, 0x85, 0xea, 0x8b, 0x71, 0xe4, 0x82, 0xa7, 0x4f, 0x38, 0x2d, 0x2c, 0xe5,
+            0xeb, 0xee, 0xe8, 0xfd, 0xb2, 0x17, 0x2f, 0x47, 0x7d, 0xf4, 0x90, 0x0d, 0x31, 0x05, 0x36, 0xc0,
+        }},
+    },
+    {
+        .privateKey = {.octets = {
+            0xb7, 0xe1, 0x51, 0x62, 0x8a, 0xed, 0x2a, 0x6a, 0xbf, 0x71, 0x58, 0x80, 0x9c, 0xf4, 0xf3, 0xc7,
+            0x62, 0xe7, 0x16, 0x0f, 0x38, 0xb4, 0xda, 0x56, 0xa7, 0x84, 0xd9, 0x04, 0x51, 0x90, 0xcf, 0xef,
+        }},
+        .publicKey = {.octets = {
+            0x02,
+            0xdf, 0xf1, 0xd7, 0x7f, 0x2a, 0x67, 0x1c, 0x5f, 0x36, 0x18, 0x37, 0x26, 0xdb, 0x23, 0x41, 0xbe,
+            0x58, 0xfe, 0xae, 0x1d, 0xa2, 0xde, 0xce, 0xd8, 0x43, 0x24, 0x0f, 0x7b, 0x50, 0x2b, 0xa6, 0x59,
+        }},
+        .auxRand = {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        },
+        .hash = {
+            0x24, 0x3f, 0x6a, 0x88, 0x85, 0xa3, 0x08, 0xd3, 0x13, 0x19, 0x8a, 0x2e, 0x03, 0x70, 0x73, 0x44,
+            0xa4, 0x09, 0x38, 0x22, 0x29, 0x9f, 0x31, 0xd0, 0x08, 0x2e, 0xfa, 0x98, 0xec, 0x4e, 0x6c, 0x89,
+        },
+        .signature = {.octets = {
+            0x68, 0x96, 0xbd, 0x60, 0xee, 0xae, 0x29, 0x6d, 0xb4, 0x8a, 0x22, 0x9f, 0xf7, 0x1d, 0xfe, 0x07,
+            0x1b, 0xde, 0x41, 0x3e, 0x6d, 0x43, 0xf9, 0x17, 0xdc, 0x8d, 0xcf, 0x8c, 0x78, 0xde, 0x33, 0x41,
+            0x89, 0x06, 0xd1, 0x1a, 0xc9, 0x76, 0xab, 0xcc, 0xb2, 0x0b, 0x09, 0x12, 0x92, 0xbf, 0xf4, 0xea,
+            0x89, 0x7e, 0xfc, 0xb6, 0x39, 0xea, 0x87, 0x1c, 0xfa, 0x95, 0xf6, 0xde, 0x33, 0x9e, 0x4b, 0x0a,
+        }},
+    },
+};
+
+/* BIP340 test vector 5, public key is not on the curve. */
+static CRYPTO_publicKey bip340InvalidPublicKey = {
+    .octets = {
+    0x02,
+    0xee, 0xfd, 0xea, 0x4c, 0xdb, 0x67, 0x77, 0x50, 0xa4, 0x20, 0xfe, 0xe8, 0x07, 0xea, 0xcf, 0x21,
+    0xeb, 0x98, 0x98, 0xae, 0x79, 0xb9, 0x76, 0x87, 0x66, 0xe4, 0xfa, 0xa0, 0x4a, 0x2d, 0x4a, 0x34}
+};
+
+static CRYPTO_signature bip340InvalidSignature = {
+    .octets = {
+    0x6c, 0xff, 0x5c, 0x3b, 0xa8, 0x6c, 0x69, 0xea, 0x4b, 0x73, 0x76, 0xf3, 0x1a, 0x9b, 0xcb, 0x4f,
+    0x74, 0xc1, 0x97, 0x60, 0x89, 0xb2, 0xd9, 0x96, 0x3d, 0xa2, 0xe5, 0x54, 0x3e, 0x17, 0x77, 0x69,
+    0x69, 0xe8, 0x9b, 0x4c, 0x55, 0x64, 0xd0, 0x03, 0x49, 0x10, 0x6b, 0x84, 0x97, 0x78, 0x5d, 0xd7,
+    0xd1, 0xd7, 0x13, 0xa8, 0xae, 0x82, 0xb3, 0x2f, 0xa7, 0x9d, 0x5f, 0x7f, 0xc4, 0x07, 0xd3, 0x9b}
+};
+
 static uint8_t hash[] =
 {
     // SHA256("Hello Bob!")
@@ -73,7 +206,7 @@ int hdTests(void)
     /* Test 3. Sign. */
     testNo++;
     CRYPTO_signature signature;
-    if (CRYPTO_sign(&childHdNode.privateKey, hash, sizeof(hash), &signature) != OTK_RETURN_OK) {
+    if (CRYPTO_sign(&childHdNode.privateKey, hash, sizeof(hash), &signature, NULL) != OTK_RETURN_OK) {
         NRF_LOG_ERROR("Test %d failed", testNo);
         return (3);
     }
@@ -88,11 +221,1363 @@ int hdTests(void)
     return (0);
 }
 
+/*
+ * ======== unittest_cycles() ========
+ * Read DWT cycle counter, enable it on first use.
+ */
+static uint32_t unittest_cycles(void)
+{
+    if (0 == (DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return (DWT->CYCCNT);
+}
+
+/* Cycles taken by last UNITTEST_TIME(). */
+static uint32_t unittestCycles;
+
+/*
+ * ======== UNITTEST_TIME() ========
+ * Run expr, keep cycles it took in unittestCycles and log them under label (a string literal).
+ */
+#define UNITTEST_TIME(label, expr) \
+    do { \
+        unittestCycles = unittest_cycles(); \
+        expr; \
+        unittestCycles = unittest_cycles() - unittestCycles; \
+        NRF_LOG_INFO(label ": %u cycles", unittestCycles); \
+    } while (0)
+
+/*
+ * ======== hdCacheTests() ========
+ * Derivation cache tests, cached result must equal uncached one.
+ * Also log cycles spent for deriving from scratch and from each cached level.
+ */
+int hdCacheTests(void)
+{
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_HDNode uncachedNode = {0};
+    CRYPTO_HDNode cachedNode = {0};
+    CRYPTO_derivativePath path = {.derivativeIndex = {1, 2, 3, 4, 5}};
+    OTK_Return ret;
+    int level;
+
+    if (CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Cache test, derive master failed");
+        return (1);
+    }
+
+    /* Changing index of each level, from leaf to root. */
+    for (level = CRYPTO_DERIVATIVE_DEPTH - 1; level >= 0; level--) {
+        CRYPTO_clearDeriveCache();
+        UNITTEST_TIME("Derive uncached", ret = CRYPTO_deriveHdNode(&hdNode, &uncachedNode, &path, NULL));
+        if (ret != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Cache test, level %d uncached derive failed", level);
+            return (2);
+        }
+
+        path.derivativeIndex[level]++;
+        UNITTEST_TIME("Derive changed level", ret = CRYPTO_deriveHdNode(&hdNode, &cachedNode, &path, NULL));
+        if (ret != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Cache test, level %d cached derive failed", level);
+            return (3);
+        }
+
+        CRYPTO_clearDeriveCache();
+        if (CRYPTO_deriveHdNode(&hdNode, &uncachedNode, &path, NULL) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Cache test, level %d uncached derive failed", level);
+            return (4);
+        }
+        if (0 != memcmp(&uncachedNode, &cachedNode, sizeof(CRYPTO_HDNode))) {
+            NRF_LOG_ERROR("Cache test, level %d cached node mismatched", level);
+            return (5);
+        }
+    }
+
+    return (0);
+}
+
+/*
+ * ======== pubKeyTests() ========
+ * Public key computed by the comb table must equal the one computed by nrf_crypto,
+ * with blinding reset or randomized, and the BIP32 test vector 2 master must give the
+ * expected extended public key.
+ * Also log cycles spent by both.
+ */
+int pubKeyTests(void)
+{
+    CRYPTO_HDNode masterNode = {0};
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_derivativePath path = {.derivativeIndex = {0, 1, 2, 3, 4}};
+    CRYPTO_extPublicKey extPublicKey;
+    secp256k1_context *ctx_ptr = (secp256k1_context *)1; /* Give a non-null value. */
+    secp256k1_pubkey pubKey;
+    uint8_t tablePubKey[CRYPTO_PUBLIC_KEY_SZ];
+    size_t length;
+    nrf_crypto_ecc_private_key_t priKeyInt;
+    nrf_crypto_ecc_public_key_t pubKeyInt;
+    nrf_crypto_ecc_secp256k1_raw_public_key_t pubKeyRaw;
+    nrf_crypto_ecc_public_key_calculate_context_t calcContext;
+    bool ok;
+    int level;
+
+    if ((CRYPTO_deriveHdNode(NULL, &masterNode, NULL, &seed2) != OTK_RETURN_OK) ||
+        (CRYPTO_encodeExtPublicKey(&masterNode, &extPublicKey) != OTK_RETURN_OK)) {
+        NRF_LOG_ERROR("Pubkey test, derive master failed");
+        return (1);
+    }
+    if (0 != strcmp(extPublicKey.str_ptr, seed2ExtPublicKey)) {
+        NRF_LOG_ERROR("Pubkey test, master extended public key mismatched");
+        return (2);
+    }
+
+    for (level = 0; level < CRYPTO_DERIVATIVE_DEPTH; level++) {
+        path.derivativeIndex[level] += level;
+        CRYPTO_clearDeriveCache();
+        if (CRYPTO_deriveHdNode(&masterNode, &hdNode, &path, NULL) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Pubkey test, derive child failed");
+            return (3);
+        }
+
+        /* Level 0 runs with blinding reset to b = 1, the others with blinding seeded by chain code. */
+        if (1 != secp256k1_context_randomize(ctx_ptr, (0 == level) ? NULL : hdNode.chainCode.octets)) {
+            NRF_LOG_ERROR("Pubkey test, randomize blinding failed");
+            return (7);
+        }
+
+        length = sizeof(tablePubKey);
+        UNITTEST_TIME("Pubkey comb table",
+            ok = (1 == secp256k1_ec_pubkey_create(ctx_ptr, &pubKey, hdNode.privateKey.octets)) &&
+                 (1 == secp256k1_ec_pubkey_serialize(ctx_ptr, tablePubKey, &length, &pubKey, SECP256K1_EC_COMPRESSED)));
+        if (!ok) {
+            NRF_LOG_ERROR("Pubkey test, comb table calculation failed");
+            return (4);
+        }
+
+        length = sizeof(pubKeyRaw);
+        UNITTEST_TIME("Pubkey nrf_crypto",
+            ok = (NRF_SUCCESS == nrf_crypto_ecc_private_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
+                     &priKeyInt, hdNode.privateKey.octets, CRYPTO_PRIVATE_KEY_SZ)) &&
+                 (NRF_SUCCESS == nrf_crypto_ecc_public_key_calculate(&calcContext, &priKeyInt, &pubKeyInt)) &&
+                 (NRF_SUCCESS == nrf_crypto_ecc_public_key_to_raw(&pubKeyInt, pubKeyRaw, &length)));
+        if (!ok) {
+            NRF_LOG_ERROR("Pubkey test, nrf_crypto calculation failed");
+            return (5);
+        }
+        nrf_crypto_ecc_private_key_free(&priKeyInt);
+        nrf_crypto_ecc_public_key_free(&pubKeyInt);
+
+        if ((tablePubKey[0] != (0x02 | (pubKeyRaw[length - 1] & 1))) ||
+            (0 != memcmp(tablePubKey + 1, pubKeyRaw, 32)) ||
+            (0 != memcmp(tablePubKey, hdNode.publicKey.octets, CRYPTO_PUBLIC_KEY_SZ))) {
+            NRF_LOG_ERROR("Pubkey test, level %d public key mismatched", level);
+            return (6);
+        }
+    }
+
+    return (0);
+}
+
+/*
+ * ======== signTests() ========
+ * Signature must match the RFC6979 vector and be verified by nrf_crypto.
+ * Also log cycles and signatures per second of current CRYPTO_sign and of micro-ecc.
+ */
+int signTests(void)
+{
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_signature signature;
+    nrf_crypto_ecc_private_key_t priKeyInt;
+    nrf_crypto_ecdsa_sign_context_t signContext;
+    size_t sigLen;
+    OTK_Return ret;
+    bool ok;
+
+#if CRYPTO_USE_NATIVE_ECDSA_SIGN
+    if ((CRYPTO_sign(&rfc6979PrivateKey, rfc6979Hash, sizeof(rfc6979Hash), &signature, NULL) != OTK_RETURN_OK) ||
+        (0 != memcmp(signature.octets, rfc6979Signature, CRYPTO_SIGNATURE_SZ))) {
+        NRF_LOG_ERROR("Sign test, RFC6979 signature mismatched");
+        return (1);
+    }
+#endif
+
+    if (CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Sign test, derive master failed");
+        return (2);
+    }
+
+    UNITTEST_TIME("CRYPTO_sign", ret = CRYPTO_sign(&hdNode.privateKey, hash, sizeof(hash), &signature, NULL));
+    if (ret != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Sign test, sign failed");
+        return (3);
+    }
+    NRF_LOG_INFO("CRYPTO_sign: %u sig/s", SystemCoreClock / unittestCycles);
+
+    if (CRYPTO_verify(&hdNode.publicKey, hash, sizeof(hash), &signature) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Sign test, verify failed");
+        return (4);
+    }
+
+    sigLen = CRYPTO_SIGNATURE_SZ;
+    UNITTEST_TIME("micro-ecc sign",
+        ok = (NRF_SUCCESS == nrf_crypto_ecc_private_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
+                 &priKeyInt, hdNode.privateKey.octets, CRYPTO_PRIVATE_KEY_SZ)) &&
+             (NRF_SUCCESS == nrf_crypto_ecdsa_sign(&signContext, &priKeyInt, hash, sizeof(hash),
+                 signature.octets, &sigLen)));
+    if (!ok) {
+        NRF_LOG_ERROR("Sign test, micro-ecc sign failed");
+        return (5);
+    }
+    nrf_crypto_ecc_private_key_free(&priKeyInt);
+    NRF_LOG_INFO("micro-ecc sign: %u sig/s", SystemCoreClock / unittestCycles);
+
+    return (0);
+}
+
+/*
+ * ======== verifyCacheTests() ========
+ * Verify against cached keys must behave as uncached, including rejecting a bad signature.
+ * Also log cycles of the first (importing) and the cached verification.
+ */
+int verifyCacheTests(void)
+{
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_HDNode childHdNode = {0};
+    CRYPTO_derivativePath path = {.derivativeIndex = {1, 2, 3, 4, 5}};
+    CRYPTO_signature signature;
+    OTK_Return ret;
+    int i;
+
+    if ((CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) ||
+        (CRYPTO_deriveHdNode(&hdNode, &childHdNode, &path, NULL) != OTK_RETURN_OK)) {
+        NRF_LOG_ERROR("Verify cache test, derive failed");
+        return (1);
+    }
+
+    CRYPTO_clearVerifyCache(NULL);
+    for (i = 0; i < 3; i++) {
+        if (CRYPTO_sign(&childHdNode.privateKey, hash, sizeof(hash), &signature, NULL) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Verify cache test, sign failed");
+            return (2);
+        }
+        UNITTEST_TIME("Verify round", ret = CRYPTO_verify(&childHdNode.publicKey, hash, sizeof(hash), &signature));
+        if (ret != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Verify cache test, round %d verify failed", i);
+            return (3);
+        }
+
+        /* Master key must not be answered by derivative's entry. */
+        if (CRYPTO_verify(&hdNode.publicKey, hash, sizeof(hash), &signature) == OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Verify cache test, round %d verified with wrong key", i);
+            return (4);
+        }
+
+        signature.octets[CRYPTO_SIGNATURE_SZ - 1] ^= 0x01;
+        if (CRYPTO_verify(&childHdNode.publicKey, hash, sizeof(hash), &signature) == OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Verify cache test, round %d bad signature verified", i);
+            return (5);
+        }
+    }
+    CRYPTO_clearVerifyCache(&childHdNode.publicKey);
+
+    return (0);
+}
+
+/*
+ * ======== signBatchTests() ========
+ * Batch signatures must be valid and report per-item status.
+ * Also log cycles of a batch against signing the same hashes one by one.
+ */
+#define UNITTEST_BATCH_SZ   (4)
+int signBatchTests(void)
+{
+    CRYPTO_HDNode hdNode = {0};
+    uint8_t hashes[UNITTEST_BATCH_SZ][CRYPTO_HASH_SZ];
+    CRYPTO_signature signatures[UNITTEST_BATCH_SZ];
+    CRYPTO_signature signature;
+    OTK_Return status[UNITTEST_BATCH_SZ];
+    OTK_Return ret;
+    int i;
+
+    if (CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Batch test, derive master failed");
+        return (1);
+    }
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        memcpy(hashes[i], hash, CRYPTO_HASH_SZ);
+        hashes[i][0] ^= i;
+    }
+
+    UNITTEST_TIME("Batch sign", ret = CRYPTO_signBatch(CRYPTO_SIG_ECDSA, &hdNode.privateKey, &hdNode.publicKey,
+        (uint8_t *)hashes, UNITTEST_BATCH_SZ, signatures, NULL, status));
+    if (ret != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Batch test, batch sign failed");
+        return (2);
+    }
+
+    /* Stop at first failure, checked after the loop. */
+    UNITTEST_TIME("Single sign",
+        for (i = 0, ret = OTK_RETURN_OK; (i < UNITTEST_BATCH_SZ) && (ret == OTK_RETURN_OK); i++) {
+            if ((CRYPTO_sign(&hdNode.privateKey, hashes[i], CRYPTO_HASH_SZ, &signature, NULL) != OTK_RETURN_OK) ||
+                (CRYPTO_verify(&hdNode.publicKey, hashes[i], CRYPTO_HASH_SZ, &signature) != OTK_RETURN_OK)) {
+                ret = OTK_RETURN_FAIL;
+            }
+        });
+    if (ret != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Batch test, single sign failed");
+        return (3);
+    }
+
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        if ((status[i] != OTK_RETURN_OK) ||
+            (CRYPTO_verify(&hdNode.publicKey, hashes[i], CRYPTO_HASH_SZ, &signatures[i]) != OTK_RETURN_OK)) {
+            NRF_LOG_ERROR("Batch test, item %d invalid", i);
+            return (4);
+        }
+    }
+
+    return (0);
+}
+
+/*
+ * ======== unittest_microEccVerify() ========
+ * Verify with micro-ecc through nrf_crypto, reference for CRYPTO_verify.
+ */
+static bool unittest_microEccVerify(CRYPTO_publicKey *publicKey_ptr, const uint8_t *hash_ptr, CRYPTO_signature *signature_ptr)
+{
+    secp256k1_pubkey decompressedKey;
+    nrf_crypto_ecc_public_key_t pubKeyInt;
+    ret_code_t errCode;
+
+    if ((1 != secp256k1_ec_pubkey_parse((secp256k1_context *)1, &decompressedKey, publicKey_ptr->octets, CRYPTO_PUBLIC_KEY_SZ)) ||
+        (NRF_SUCCESS != nrf_crypto_ecc_public_key_from_raw(&g_nrf_crypto_ecc_secp256k1_curve_info,
+            &pubKeyInt, decompressedKey.data, CRYPTO_DECOMP_PUBLIC_KEY_SZ))) {
+        return (false);
+    }
+    errCode = nrf_crypto_ecdsa_verify(NULL, &pubKeyInt, hash_ptr, CRYPTO_HASH_SZ, signature_ptr->octets, CRYPTO_SIGNATURE_SZ);
+    nrf_crypto_ecc_public_key_free(&pubKeyInt);
+
+    return (errCode == NRF_SUCCESS);
+}
+
+/*
+ * ======== verifyTests() ========
+ * CRYPTO_verify must agree with micro-ecc on valid, high S and tampered signatures.
+ * Also log cycles of both.
+ */
+int verifyTests(void)
+{
+    /* Group order, s is replaced by n - s for the high S form. */
+    static const uint8_t order[CRYPTO_HASH_SZ] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+        0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x41,
+    };
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_signature signature;
+    uint8_t msgHash[CRYPTO_HASH_SZ];
+    bool expected;
+    int borrow;
+    int i, j, k;
+
+    if (CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Verify test, derive master failed");
+        return (1);
+    }
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        memcpy(msgHash, hash, CRYPTO_HASH_SZ);
+        msgHash[0] ^= i;
+        if (CRYPTO_sign(&hdNode.privateKey, msgHash, CRYPTO_HASH_SZ, &signature, NULL) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Verify test, sign failed");
+            return (2);
+        }
+        /* 0 - as signed, 1 - high S, 2 - tampered hash. */
+        for (k = 0; k < 3; k++) {
+            if (k == 1) {
+                for (j = CRYPTO_HASH_SZ - 1, borrow = 0; j >= 0; j--) {
+                    int d = order[j] - signature.octets[CRYPTO_HASH_SZ + j] - borrow;
+                    borrow = (d < 0);
+                    signature.octets[CRYPTO_HASH_SZ + j] = (uint8_t)d;
+                }
+            }
+            else if (k == 2) {
+                msgHash[CRYPTO_HASH_SZ - 1] ^= 0x80;
+            }
+            expected = (k != 2);
+            if ((unittest_microEccVerify(&hdNode.publicKey, msgHash, &signature) != expected) ||
+                ((CRYPTO_verify(&hdNode.publicKey, msgHash, CRYPTO_HASH_SZ, &signature) == OTK_RETURN_OK) != expected)) {
+                NRF_LOG_ERROR("Verify test, item %d case %d mismatched", i, k);
+                return (3);
+            }
+        }
+    }
+
+    memcpy(msgHash, hash, CRYPTO_HASH_SZ);
+    CRYPTO_sign(&hdNode.privateKey, msgHash, CRYPTO_HASH_SZ, &signature, NULL);
+    CRYPTO_verify(&hdNode.publicKey, msgHash, CRYPTO_HASH_SZ, &signature); /* Cache the key. */
+    UNITTEST_TIME("secp256k1 verify", CRYPTO_verify(&hdNode.publicKey, msgHash, CRYPTO_HASH_SZ, &signature));
+    NRF_LOG_INFO("secp256k1 verify: %u verify/s", SystemCoreClock / unittestCycles);
+    UNITTEST_TIME("micro-ecc verify (with import)", unittest_microEccVerify(&hdNode.publicKey, msgHash, &signature));
+    NRF_LOG_INFO("micro-ecc verify (with import): %u verify/s", SystemCoreClock / unittestCycles);
+
+    return (0);
+}
+
+/*
+ * ======== hash160Tests() ========
+ * Hash160 kept in HD node must match BIP32 test vector 2 and the recomputed one,
+ * for derived and cached nodes. Also log cycles of one hash160, saved per derivation level.
+ */
+int hash160Tests(void)
+{
+    CRYPTO_HDNode masterNode = {0};
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_HDNode checkNode = {0};
+    CRYPTO_derivativePath path = {.derivativeIndex = {1, 2, 3, 4, 5}};
+
+    if (CRYPTO_deriveHdNode(NULL, &masterNode, NULL, &seed2) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Hash160 test, derive master failed");
+        return (1);
+    }
+    if (0 != memcmp(masterNode.hash160.octets, seed2MasterHash160, CRYPTO_HASH160_SZ)) {
+        NRF_LOG_ERROR("Hash160 test, master hash160 mismatched");
+        return (2);
+    }
+
+    CRYPTO_clearDeriveCache();
+    if (CRYPTO_deriveHdNode(&masterNode, &hdNode, &path, NULL) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Hash160 test, derive child failed");
+        return (3);
+    }
+    memcpy(&checkNode, &hdNode, sizeof(CRYPTO_HDNode));
+    memset(&checkNode.hash160, 0, sizeof(CRYPTO_hash160));
+    UNITTEST_TIME("Hash160", CRYPTO_refreshHash160(&checkNode));
+    if (0 != memcmp(&checkNode, &hdNode, sizeof(CRYPTO_HDNode))) {
+        NRF_LOG_ERROR("Hash160 test, child hash160 mismatched");
+        return (4);
+    }
+
+    /* Leaf level changed, the rest comes from cache and has to carry hash160 along. */
+    path.derivativeIndex[CRYPTO_DERIVATIVE_DEPTH - 1]++;
+    if (CRYPTO_deriveHdNode(&masterNode, &hdNode, &path, NULL) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Hash160 test, derive cached child failed");
+        return (5);
+    }
+    memcpy(&checkNode, &hdNode, sizeof(CRYPTO_HDNode));
+    CRYPTO_refreshHash160(&checkNode);
+    if (0 != memcmp(&checkNode, &hdNode, sizeof(CRYPTO_HDNode))) {
+        NRF_LOG_ERROR("Hash160 test, cached child hash160 mismatched");
+        return (6);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== schnorrTests() ========
+ * Schnorr signatures must match BIP340 vectors and verify, tampered or invalid ones must not.
+ * Batch Schnorr signatures (fresh auxiliary randomness) must verify.
+ * Also log cycles of Schnorr sign/verify against ECDSA sign/verify.
+ */
+int schnorrTests(void)
+{
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_signature signature;
+    CRYPTO_signature signatures[UNITTEST_BATCH_SZ];
+    uint8_t hashes[UNITTEST_BATCH_SZ][CRYPTO_HASH_SZ];
+    int i;
+
+    for (i = 0; i < (int)(sizeof(bip340Vectors) / sizeof(bip340Vectors[0])); i++) {
+        const unittest_bip340Vector *vec_ptr = &bip340Vectors[i];
+
+        if ((CRYPTO_signSchnorr((CRYPTO_privateKey *)&vec_ptr->privateKey, vec_ptr->hash, CRYPTO_HASH_SZ,
+                vec_ptr->auxRand, &signature) != OTK_RETURN_OK) ||
+            (0 != memcmp(signature.octets, vec_ptr->signature.octets, CRYPTO_SIGNATURE_SZ))) {
+            NRF_LOG_ERROR("Schnorr test, vector %d signature mismatched", i);
+            return (1);
+        }
+        if (CRYPTO_verifySchnorr((CRYPTO_publicKey *)&vec_ptr->publicKey, vec_ptr->hash, CRYPTO_HASH_SZ,
+                &signature) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Schnorr test, vector %d verify failed", i);
+            return (2);
+        }
+        signature.octets[CRYPTO_SIGNATURE_SZ - 1] ^= 0x01;
+        if (CRYPTO_verifySchnorr((CRYPTO_publicKey *)&vec_ptr->publicKey, vec_ptr->hash, CRYPTO_HASH_SZ,
+                &signature) == OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Schnorr test, vector %d tampered signature verified", i);
+            return (3);
+        }
+    }
+    if (CRYPTO_verifySchnorr(&bip340InvalidPublicKey, bip340Vectors[1].hash, CRYPTO_HASH_SZ,
+            &bip340InvalidSignature) == OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Schnorr test, invalid public key verified");
+        return (4);
+    }
+
+    if (CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Schnorr test, derive master failed");
+        return (5);
+    }
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        memcpy(hashes[i], hash, CRYPTO_HASH_SZ);
+        hashes[i][0] ^= i;
+    }
+    if (CRYPTO_signBatch(CRYPTO_SIG_SCHNORR, &hdNode.privateKey, &hdNode.publicKey, (uint8_t *)hashes,
+            UNITTEST_BATCH_SZ, signatures, NULL, NULL) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Schnorr test, batch sign failed");
+        return (6);
+    }
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        if (CRYPTO_verifySchnorr(&hdNode.publicKey, hashes[i], CRYPTO_HASH_SZ, &signatures[i]) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Schnorr test, batch item %d invalid", i);
+            return (7);
+        }
+    }
+
+    UNITTEST_TIME("Schnorr sign", CRYPTO_signSchnorr(&hdNode.privateKey, hash, sizeof(hash), NULL, &signature));
+    NRF_LOG_INFO("Schnorr sign: %u sig/s", SystemCoreClock / unittestCycles);
+    UNITTEST_TIME("Schnorr verify", CRYPTO_verifySchnorr(&hdNode.publicKey, hash, sizeof(hash), &signature));
+
+    UNITTEST_TIME("ECDSA sign", CRYPTO_sign(&hdNode.privateKey, hash, sizeof(hash), &signature, NULL));
+    NRF_LOG_INFO("ECDSA sign: %u sig/s", SystemCoreClock / unittestCycles);
+    UNITTEST_TIME("ECDSA verify", CRYPTO_verify(&hdNode.publicKey, hash, sizeof(hash), &signature));
+
+    return (0);
+}
+
+/*
+ * ======== recoverTests() ========
+ * Public key recovered with the recovery id from CRYPTO_sign must be the signer's,
+ * a wrong recovery id must not give it. Recoverable batch must be checked by recovery.
+ * Also log cycles of recover against verify.
+ */
+int recoverTests(void)
+{
+    CRYPTO_HDNode hdNode = {0};
+    CRYPTO_signature signature;
+    CRYPTO_signature signatures[UNITTEST_BATCH_SZ];
+    CRYPTO_publicKey publicKey;
+    uint8_t hashes[UNITTEST_BATCH_SZ][CRYPTO_HASH_SZ];
+    uint8_t recIds[UNITTEST_BATCH_SZ];
+    uint8_t recId = 0xff;
+    int i;
+
+    if ((CRYPTO_sign(&rfc6979PrivateKey, rfc6979Hash, sizeof(rfc6979Hash), &signature, &recId) != OTK_RETURN_OK) ||
+        (recId > 3)) {
+        NRF_LOG_ERROR("Recover test, sign failed");
+        return (1);
+    }
+    if ((CRYPTO_recover(rfc6979Hash, sizeof(rfc6979Hash), &signature, recId, &publicKey) != OTK_RETURN_OK) ||
+        (0 != memcmp(&publicKey, &rfc6979PublicKey, sizeof(CRYPTO_publicKey)))) {
+        NRF_LOG_ERROR("Recover test, recovered public key mismatched");
+        return (2);
+    }
+    if ((CRYPTO_recover(rfc6979Hash, sizeof(rfc6979Hash), &signature, recId ^ 1, &publicKey) == OTK_RETURN_OK) &&
+        (0 == memcmp(&publicKey, &rfc6979PublicKey, sizeof(CRYPTO_publicKey)))) {
+        NRF_LOG_ERROR("Recover test, wrong recovery id recovered public key");
+        return (3);
+    }
+
+    if (CRYPTO_deriveHdNode(NULL, &hdNode, NULL, &seed1) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Recover test, derive master failed");
+        return (4);
+    }
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        memcpy(hashes[i], hash, CRYPTO_HASH_SZ);
+        hashes[i][0] ^= i;
+    }
+    if (CRYPTO_signBatch(CRYPTO_SIG_ECDSA_RECOVERABLE, &hdNode.privateKey, &hdNode.publicKey, (uint8_t *)hashes,
+            UNITTEST_BATCH_SZ, signatures, NULL, NULL) == OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Recover test, batch without recovery ids accepted");
+        return (5);
+    }
+    if (CRYPTO_signBatch(CRYPTO_SIG_ECDSA_RECOVERABLE, &hdNode.privateKey, &hdNode.publicKey, (uint8_t *)hashes,
+            UNITTEST_BATCH_SZ, signatures, recIds, NULL) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Recover test, batch sign failed");
+        return (6);
+    }
+    for (i = 0; i < UNITTEST_BATCH_SZ; i++) {
+        if (CRYPTO_verify(&hdNode.publicKey, hashes[i], CRYPTO_HASH_SZ, &signatures[i]) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Recover test, batch item %d invalid", i);
+            return (7);
+        }
+    }
+
+    UNITTEST_TIME("ECDSA recover", CRYPTO_recover(hashes[0], CRYPTO_HASH_SZ, &signatures[0], recIds[0], &publicKey));
+    UNITTEST_TIME("ECDSA verify", CRYPTO_verify(&hdNode.publicKey, hashes[0], CRYPTO_HASH_SZ, &signatures[0]));
+
+    return (0);
+}
+
+/*
+ * ======== sha256Tests() ========
+ * SHA-256 must match FIPS 180-2 vector, one block fast path of sha256_Raw() must match
+ * Init/Update/Final for every length around the block boundary. Also log cycles of
+ * hashing a compressed public key.
+ */
+int sha256Tests(void)
+{
+    static const uint8_t expected[SHA256_DIGEST_LENGTH] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+    uint8_t data[SHA256_BLOCK_LENGTH + 1];
+    uint8_t out[SHA256_DIGEST_LENGTH];
+    uint8_t check[SHA256_DIGEST_LENGTH];
+    SHA256_CTX ctx;
+    size_t i;
+
+    sha256_Raw((const uint8_t *)"abc", 3, out);
+    if (0 != memcmp(out, expected, SHA256_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("SHA256 test, digest mismatched");
+        return (1);
+    }
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 7 + 1);
+    }
+    for (i = 0; i <= sizeof(data); i++) {
+        sha256_Raw(data, i, out);
+        sha256_Init(&ctx);
+        sha256_Update(&ctx, data, i);
+        sha256_Final(check, &ctx);
+        if (0 != memcmp(out, check, SHA256_DIGEST_LENGTH)) {
+            NRF_LOG_ERROR("SHA256 test, %u bytes mismatched", i);
+            return (2);
+        }
+    }
+
+    UNITTEST_TIME("SHA256 of public key", sha256_Raw(rfc6979PublicKey.octets, CRYPTO_PUBLIC_KEY_SZ, out));
+
+    return (0);
+}
+
+/*
+ * ======== sha512Tests() ========
+ * SHA-512 must match FIPS 180-2 one and two block vectors. Also log cycles per byte.
+ */
+int sha512Tests(void)
+{
+    static const char msg1[] = "abc";
+    static const char msg2[] = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+                               "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+    static const uint8_t expected1[SHA512_DIGEST_LENGTH] = {
+        0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba, 0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+        0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2, 0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+        0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8, 0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+        0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e, 0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f};
+    static const uint8_t expected2[SHA512_DIGEST_LENGTH] = {
+        0x8e, 0x95, 0x9b, 0x75, 0xda, 0xe3, 0x13, 0xda, 0x8c, 0xf4, 0xf7, 0x28, 0x14, 0xfc, 0x14, 0x3f,
+        0x8f, 0x77, 0x79, 0xc6, 0xeb, 0x9f, 0x7f, 0xa1, 0x72, 0x99, 0xae, 0xad, 0xb6, 0x88, 0x90, 0x18,
+        0x50, 0x1d, 0x28, 0x9e, 0x49, 0x00, 0xf7, 0xe4, 0x33, 0x1b, 0x99, 0xde, 0xc4, 0xb5, 0x43, 0x3a,
+        0xc7, 0xd3, 0x29, 0xee, 0xb6, 0xdd, 0x26, 0x54, 0x5e, 0x96, 0xe5, 0x5b, 0x87, 0x4b, 0xe9, 0x09};
+    static uint8_t data[1024];
+    uint8_t out[SHA512_DIGEST_LENGTH];
+
+    sha512_Raw((const uint8_t *)msg1, strlen(msg1), out);
+    if (0 != memcmp(out, expected1, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("SHA512 test, one block digest mismatched");
+        return (1);
+    }
+    sha512_Raw((const uint8_t *)msg2, strlen(msg2), out);
+    if (0 != memcmp(out, expected2, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("SHA512 test, two block digest mismatched");
+        return (2);
+    }
+
+    UNITTEST_TIME("SHA512 of 1KB", sha512_Raw(data, sizeof(data), out));
+    NRF_LOG_INFO("SHA512: %u cycles per byte", unittestCycles / sizeof(data));
+
+    return (0);
+}
+
+/*
+ * ======== hmacTests() ========
+ * HMAC-SHA512 from prepared key midstates must match RFC 4231 test case 2,
+ * also after the midstates were used for another message.
+ */
+int hmacTests(void)
+{
+    static const uint8_t expected[SHA512_DIGEST_LENGTH] = {
+        0x16, 0x4b, 0x7a, 0x7b, 0xfc, 0xf8, 0x19, 0xe2, 0xe3, 0x95, 0xfb, 0xe7, 0x3b, 0x56, 0xe0, 0xa3,
+        0x87, 0xbd, 0x64, 0x22, 0x2e, 0x83, 0x1f, 0xd6, 0x10, 0x27, 0x0c, 0xd7, 0xea, 0x25, 0x05, 0x54,
+        0x97, 0x58, 0xbf, 0x75, 0xc0, 0x5a, 0x99, 0x4a, 0x6d, 0x03, 0x4f, 0x65, 0xf8, 0xf0, 0xe6, 0xfd,
+        0xca, 0xea, 0xb1, 0xa3, 0x4d, 0x4a, 0x6b, 0x4b, 0x63, 0x6e, 0x07, 0x0a, 0x38, 0xbc, 0xe7, 0x37};
+    static const char key[] = "Jefe";
+    static const char msg[] = "what do ya want for nothing?";
+    HMAC_SHA512_CTX hctx;
+    uint8_t out[SHA512_DIGEST_LENGTH];
+
+    hmac_sha512((const uint8_t *)key, strlen(key), (const uint8_t *)msg, strlen(msg), out);
+    if (0 != memcmp(out, expected, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("HMAC test, hmac_sha512 mismatched");
+        return (1);
+    }
+
+    hmac_sha512_Prepare((const uint8_t *)key, strlen(key), &hctx);
+    hmac_sha512_Prepared(&hctx, (const uint8_t *)key, strlen(key), out);
+    hmac_sha512_Prepared(&hctx, (const uint8_t *)msg, strlen(msg), out);
+    if (0 != memcmp(out, expected, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("HMAC test, prepared midstates mismatched");
+        return (2);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== hashWriterTests() ========
+ * Streamed session data digest must match double SHA256 of the written text,
+ * text that does not fit must be truncated and flagged. Binary fields must be
+ * written as tag, length, value.
+ */
+int hashWriterTests(void)
+{
+    char buf[64];
+    HASH_WRITER writer;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint8_t check[SHA256_DIGEST_LENGTH];
+    int i;
+
+    hashwriter_Init(&writer, buf, sizeof(buf));
+    hashwriter_Printf(&writer, "<%s>\r\n%lu\r\n", "session_id", (unsigned long)1234567890);
+    hashwriter_Write(&writer, "<request_id>\r\n", 14);
+    hashwriter_FinalDouble(&writer, digest);
+    sha256_Raw((uint8_t *)buf, strlen(buf), check);
+    sha256_Raw(check, SHA256_DIGEST_LENGTH, check);
+    if (writer.str.len != strlen(buf) || writer.str.overflow || 0 != memcmp(digest, check, SHA256_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash writer test, digest mismatched");
+        return (1);
+    }
+
+    hashwriter_Init(&writer, buf, sizeof(buf));
+    for (i = 0; i < 8; i++) {
+        hashwriter_Printf(&writer, "%s", "0123456789");
+    }
+    hashwriter_Final(&writer, digest);
+    sha256_Raw((uint8_t *)buf, sizeof(buf) - 1, check);
+    if (writer.str.len != sizeof(buf) - 1 || !writer.str.overflow || 0 != memcmp(digest, check, SHA256_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash writer test, overflow not handled");
+        return (2);
+    }
+
+    /* Binary fields, tag and length bytes followed by value. */
+    hashwriter_Init(&writer, buf, sizeof(buf));
+    hashwriter_WriteTlv(&writer, 0x01, "\x00\x01\x02", 3);
+    hashwriter_WriteTlv(&writer, 0x02, "", 0);
+    hashwriter_Final(&writer, digest);
+    sha256_Raw((uint8_t *)"\x01\x03\x00\x01\x02\x02\x00", 7, check);
+    if (writer.str.len != 7 || writer.str.overflow || 0 != memcmp(digest, check, SHA256_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash writer test, binary field mismatched");
+        return (3);
+    }
+    if (hashwriter_WriteTlv(&writer, 0x03, buf, 256) != -1 || !writer.str.overflow) {
+        NRF_LOG_ERROR("Hash writer test, binary field too long not handled");
+        return (4);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== strWriterTests() ========
+ * Appends must build the text in place, a write that does not fit must be truncated,
+ * flagged and must keep the text NUL terminated.
+ */
+int strWriterTests(void)
+{
+    char buf[16];
+    STR_WRITER writer;
+
+    strwriter_Init(&writer, buf, sizeof(buf));
+    strwriter_Write(&writer, "m", 1);
+    if (strwriter_Printf(&writer, "/%lu", (unsigned long)2147483647) != 11 ||
+            writer.len != 12 || writer.overflow || 0 != strcmp(buf, "m/2147483647")) {
+        NRF_LOG_ERROR("String writer test, append failed");
+        return (1);
+    }
+    if (strwriter_Printf(&writer, "/%lu", (unsigned long)2147483647) != -1 ||
+            writer.len != sizeof(buf) - 1 || !writer.overflow || 0 != strcmp(buf, "m/2147483647/21")) {
+        NRF_LOG_ERROR("String writer test, overflow not handled");
+        return (2);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== hashProviderTests() ========
+ * Hash provider (HASH_PROVIDER) must agree with libbtc, log its cycles on message sizes
+ * we hash the most, build with each provider to compare them.
+ */
+int hashProviderTests(void)
+{
+    static const char key[] = "Bitcoin seed";
+    HASH_HMAC_SHA512_CTX hctx;
+    uint8_t data[CRYPTO_PUBLIC_KEY_SZ + 4];
+    uint8_t out[SHA512_DIGEST_LENGTH];
+    uint8_t check[SHA512_DIGEST_LENGTH];
+    size_t i;
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 13 + 5);
+    }
+
+    NRF_LOG_INFO("Hash provider %s", HASH_PROVIDER_NAME);
+
+    /* Public key hash, as of hash160. */
+    UNITTEST_TIME("Hash provider sha256(33)", hash_sha256_Raw(data, CRYPTO_PUBLIC_KEY_SZ, out));
+    sha256_Raw(data, CRYPTO_PUBLIC_KEY_SZ, check);
+    if (0 != memcmp(out, check, SHA256_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash provider test, sha256 mismatched");
+        return (1);
+    }
+
+    /* Second round of a double SHA256. */
+    UNITTEST_TIME("Hash provider sha256(32)", hash_sha256_Raw(out, SHA256_DIGEST_LENGTH, out));
+    sha256_Raw(check, SHA256_DIGEST_LENGTH, check);
+    if (0 != memcmp(out, check, SHA256_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash provider test, double sha256 mismatched");
+        return (2);
+    }
+
+    /* Child key derivation, serP(point(kpar)) || ser32(i) under a 32 bytes chain code. */
+    UNITTEST_TIME("Hash provider hmac_sha512(37)", hash_hmac_sha512(data, CRYPTO_CHAIN_CODE_SZ, data, sizeof(data), out));
+    hmac_sha512(data, CRYPTO_CHAIN_CODE_SZ, data, sizeof(data), check);
+    if (0 != memcmp(out, check, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash provider test, hmac_sha512 mismatched");
+        return (3);
+    }
+
+    hash_hmac_sha512_Prepare(data, CRYPTO_CHAIN_CODE_SZ, &hctx);
+    UNITTEST_TIME("Hash provider prepared hmac_sha512(37)", hash_hmac_sha512_Prepared(&hctx, data, sizeof(data), out));
+    if (0 != memcmp(out, check, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash provider test, prepared hmac_sha512 mismatched");
+        return (4);
+    }
+
+    /* Master key generation, key longer than a chain code. */
+    hash_hmac_sha512((const uint8_t *)key, strlen(key), seed2.octets, CRYPTO_SEED_SIZE_OCTET, out);
+    hmac_sha512((const uint8_t *)key, strlen(key), seed2.octets, CRYPTO_SEED_SIZE_OCTET, check);
+    if (0 != memcmp(out, check, SHA512_DIGEST_LENGTH)) {
+        NRF_LOG_ERROR("Hash provider test, master hmac_sha512 mismatched");
+        return (5);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== base58Tests() ========
+ * Base58check of BIP32 test vector 2 master public key must round trip, leading zero bytes
+ * must map to '1's, corrupted strings must be rejected. Also log cycles of one extended key.
+ */
+int base58Tests(void)
+{
+    static const uint8_t zeroHash160[21] = {0};
+    static const char zeroAddr[] = "1111111111111111111114oLvT2";
+    uint8_t data[78];
+    uint8_t check[sizeof(data)];
+    char str[sizeof(seed2ExtPublicKey) + 1];
+    int length;
+
+    if (base58_decode_check(seed2ExtPublicKey, data, sizeof(data)) != sizeof(data)) {
+        NRF_LOG_ERROR("Base58 test, decode failed");
+        return (1);
+    }
+    UNITTEST_TIME("Base58check of extended key", length = base58_encode_check(data, sizeof(data), str, sizeof(str)));
+    if (length != sizeof(seed2ExtPublicKey)) {
+        NRF_LOG_ERROR("Base58 test, encode failed");
+        return (2);
+    }
+    if (0 != strcmp(str, seed2ExtPublicKey)) {
+        NRF_LOG_ERROR("Base58 test, extended key mismatched");
+        return (3);
+    }
+
+    if (base58_encode_check(zeroHash160, sizeof(zeroHash160), str, sizeof(str)) != sizeof(zeroAddr) ||
+            0 != strcmp(str, zeroAddr)) {
+        NRF_LOG_ERROR("Base58 test, leading zeros mismatched");
+        return (4);
+    }
+    if (base58_decode_check(zeroAddr, check, sizeof(zeroHash160)) != sizeof(zeroHash160) ||
+            0 != memcmp(check, zeroHash160, sizeof(zeroHash160))) {
+        NRF_LOG_ERROR("Base58 test, leading zeros decode failed");
+        return (5);
+    }
+
+    /* Last digit changed, checksum must fail. */
+    memcpy(str, seed2ExtPublicKey, sizeof(seed2ExtPublicKey));
+    str[sizeof(seed2ExtPublicKey) - 2] = (str[sizeof(seed2ExtPublicKey) - 2] == 'A') ? 'B' : 'A';
+    if (base58_decode_check(str, check, sizeof(check)) != 0) {
+        NRF_LOG_ERROR("Base58 test, corrupted string accepted");
+        return (6);
+    }
+    /* Output buffer one byte short. */
+    if (base58_encode_check(data, sizeof(data), str, sizeof(seed2ExtPublicKey) - 1) != 0) {
+        NRF_LOG_ERROR("Base58 test, short buffer accepted");
+        return (7);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== hexTests() ========
+ * Hex decoding must report the offset of the first invalid character, digest lists
+ * must be decoded into packed, zero padded digests and stop at errors or maxcount.
+ */
+int hexTests(void)
+{
+    static const char list[] =
+        "00112233445566778899aabbccddeeff00112233445566778899AABBCCDDEEFF\n"
+        "\n"
+        "0102\n";
+    uint8_t digests[3][UTILS_DIGEST_LEN];
+    uint8_t bin[4];
+    int errOffset;
+
+    if (utils_hex_decode("a1B2c3D4", 8, bin, sizeof(bin), &errOffset) != 4 || errOffset != -1 ||
+            bin[0] != 0xa1 || bin[1] != 0xb2 || bin[2] != 0xc3 || bin[3] != 0xd4) {
+        NRF_LOG_ERROR("Hex test, decode failed");
+        return (1);
+    }
+    if (utils_hex_decode("a1b2x3", 6, bin, sizeof(bin), &errOffset) != -1 || errOffset != 4) {
+        NRF_LOG_ERROR("Hex test, invalid character offset %d", errOffset);
+        return (2);
+    }
+    if (utils_hex_decode("a1b", 3, bin, sizeof(bin), &errOffset) != -1 || errOffset != 3) {
+        NRF_LOG_ERROR("Hex test, odd length accepted");
+        return (3);
+    }
+
+    if (utils_hex_to_digests(list, digests[0], 3, &errOffset) != 2 || errOffset != -1 ||
+            digests[0][0] != 0x00 || digests[0][15] != 0xff || digests[0][31] != 0xff ||
+            digests[1][0] != 0x01 || digests[1][1] != 0x02 || digests[1][2] != 0x00 || digests[1][31] != 0x00) {
+        NRF_LOG_ERROR("Hex test, digest list decode failed");
+        return (4);
+    }
+    /* Stop at the second digest when only one fits. */
+    if (utils_hex_to_digests(list, digests[0], 1, &errOffset) != 1 || errOffset != 66) {
+        NRF_LOG_ERROR("Hex test, digest list maxcount offset %d", errOffset);
+        return (5);
+    }
+    if (utils_hex_to_digests("0102\n01g2", digests[0], 3, &errOffset) != 1 || errOffset != 7) {
+        NRF_LOG_ERROR("Hex test, digest list invalid offset %d", errOffset);
+        return (6);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== sighashTests() ========
+ * BIP143 native P2WPKH example, fed one byte at a time and at once, must give the published
+ * hashOutputs and the digest of input 1, and count its second output as change of that output's key.
+ * Truncated and trailing data must be rejected.
+ */
+int sighashTests(void)
+{
+    static const char txHex[] =
+        "0100000002fff7f7881a8099afa6940d42d1e7f6362bec38171ea3edf433541db4e4ad969f0000000000eeffffff"
+        "ef51e1b804cc89d182d279655c3aa89e815b1b309fe287d9b2b55d57b90ec68a0100000000ffffffff02202cb206"
+        "000000001976a9148280b37df378db99f66f85c95a783a76ac7a6d5988ac9093510d000000001976a9143bde42db"
+        "ee7e4dbe6a21b2d50ce2f0167faa815988ac11000000"
+        "40be402500000000"      /* Amounts of spent outputs, 6.25 and 6 BTC */
+        "0046c32300000000";
+    static const uint8_t keyHash160[20] = {
+        0x1d, 0x0f, 0x17, 0x2a, 0x0e, 0xcb, 0x48, 0xae, 0xe1, 0xbe, 0x1f, 0x26, 0x87, 0xd2, 0x96, 0x3a,
+        0xe3, 0x3f, 0x71, 0xa1};
+    static const uint8_t changeHash160[20] = {
+        0x3b, 0xde, 0x42, 0xdb, 0xee, 0x7e, 0x4d, 0xbe, 0x6a, 0x21, 0xb2, 0xd5, 0x0c, 0xe2, 0xf0, 0x16,
+        0x7f, 0xaa, 0x81, 0x59};
+    static const uint8_t hashOutputs[SHA256_DIGEST_LENGTH] = {
+        0x86, 0x3e, 0xf3, 0xe1, 0xa9, 0x2a, 0xfb, 0xfd, 0xb9, 0x7f, 0x31, 0xad, 0x0f, 0xc7, 0x68, 0x3e,
+        0xe9, 0x43, 0xe9, 0xab, 0xcf, 0x25, 0x01, 0x59, 0x0f, 0xf8, 0xf6, 0x55, 0x1f, 0x47, 0xe5, 0xe5};
+    static const uint8_t sighash1[SHA256_DIGEST_LENGTH] = {
+        0xc3, 0x7a, 0xf3, 0x11, 0x16, 0xd1, 0xb2, 0x7c, 0xaf, 0x68, 0xaa, 0xe9, 0xe3, 0xac, 0x82, 0xf1,
+        0x47, 0x79, 0x29, 0x01, 0x4d, 0x5b, 0x91, 0x76, 0x57, 0xd0, 0xeb, 0x49, 0x47, 0x8c, 0xb6, 0x70};
+    static SIGHASH_TX tx;
+    uint8_t raw[(sizeof(txHex) - 1) / 2];
+    uint8_t digests[2][SHA256_DIGEST_LENGTH];
+    bool ok;
+    int errOffset;
+    int i;
+
+    if (utils_hex_decode(txHex, sizeof(txHex) - 1, raw, sizeof(raw), &errOffset) != sizeof(raw)) {
+        NRF_LOG_ERROR("Sighash test, decode failed");
+        return (1);
+    }
+
+    sighash_Init(&tx);
+    sighash_SetChangeKey(&tx, changeHash160);
+    for (i = 0; i < sizeof(raw); i++) {
+        sighash_Update(&tx, raw + i, 1);
+    }
+    if (sighash_Final(&tx) != 0 || tx.inputCount != 2 || tx.outputTotal != 335790000 ||
+            tx.changeTotal != 223450000 || 0 != memcmp(tx.hashOutputs, hashOutputs, sizeof(hashOutputs))) {
+        NRF_LOG_ERROR("Sighash test, chunked parse failed");
+        return (2);
+    }
+
+    UNITTEST_TIME("BIP143 digests of 2 inputs",
+        sighash_Init(&tx);
+        ok = (sighash_Update(&tx, raw, sizeof(raw)) == 0) && (sighash_Final(&tx) == 0);
+        if (ok) {
+            sighash_DigestP2wpkh(&tx, keyHash160, digests[0]);
+        });
+    if (!ok) {
+        NRF_LOG_ERROR("Sighash test, parse failed");
+        return (3);
+    }
+    if (0 != memcmp(digests[1], sighash1, sizeof(sighash1))) {
+        NRF_LOG_ERROR("Sighash test, digest mismatched");
+        return (4);
+    }
+
+    sighash_Init(&tx);
+    sighash_Update(&tx, raw, sizeof(raw) - 1);
+    if (sighash_Final(&tx) == 0) {
+        NRF_LOG_ERROR("Sighash test, truncated data accepted");
+        return (5);
+    }
+    sighash_Init(&tx);
+    sighash_Update(&tx, raw, sizeof(raw));
+    if (sighash_Update(&tx, raw, 1) == 0) {
+        NRF_LOG_ERROR("Sighash test, trailing data accepted");
+        return (6);
+    }
+
+    return (0);
+}
+
+#if (UNITTEST)
+/* BIP32 test vector 2, master public key, private key in WIF and address. */
+static const char seed2HexPublicKey[] = "03cbcaa9c98c877a26977d00825c956a238e8dddfbd322cce4f74b0b5bd6ace4a7";
+static const char seed2WIFPrivateKey[] = "KyjXhyHF9wTphBkfpxjL8hkDXDUSbE3tKANT94kXSyh6vn6nKaoy";
+static const char seed2BtcAddr[] = "1JEoxevbLLG8cVqeoGKQiAwoWbNYSUyYjg";
+
+/*
+ * ======== keyFileTests() ========
+ * Keys restored from key file of every layout must give BIP32 test vector 2 master strings,
+ * encoded on first request, and keep derivative key, path and settings of slot 0.
+ * Device keys are loaded again at the end.
+ */
+int keyFileTests(void)
+{
+    static const KEY_FileLayout layouts[] = {KEY_FILE_LEGACY, KEY_FILE_RAW, KEY_FILE_SINGLE, KEY_FILE_CURRENT};
+    static KEY_Object keyObj;
+    CRYPTO_extPublicKey extPublicKey;
+    bool isLegacy;
+    int i;
+
+    memset(&keyObj, 0, sizeof(keyObj));
+    CRYPTO_setDerivativePath(&keyObj.slots[0].path, 4, 5);
+    if (CRYPTO_deriveHdNode(NULL, &keyObj.master, NULL, &seed2) != OTK_RETURN_OK ||
+            CRYPTO_deriveHdNode(&keyObj.master, &keyObj.slots[0].derivative, &keyObj.slots[0].path, NULL) != OTK_RETURN_OK ||
+            CRYPTO_encodeExtPublicKey(&keyObj.slots[0].derivative, &extPublicKey) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Key file test, derive failed");
+        return (1);
+    }
+    keyObj.pin = 12345678;
+    keyObj.pin_auth_failures = 1;
+    keyObj.pin_retry_after = 2;
+    strcpy(keyObj.keyNote, "unittest");
+
+    for (i = 0; i < sizeof(layouts) / sizeof(layouts[0]); i++) {
+        if (KEY_restoreLayout(layouts[i], &keyObj, &isLegacy) != OTK_RETURN_OK ||
+                isLegacy != (KEY_FILE_CURRENT != layouts[i])) {
+            NRF_LOG_ERROR("Key file test, layout %d restore failed", layouts[i]);
+            return (2);
+        }
+        if (0 != memcmp(KEY_getHash160(KEY_MASTER), seed2MasterHash160, sizeof(seed2MasterHash160)) ||
+                0 != strcmp(KEY_getHexPublicKey(KEY_MASTER), seed2HexPublicKey) ||
+                0 != strcmp(KEY_getExtPublicKey(KEY_MASTER), seed2ExtPublicKey) ||
+                0 != strcmp(KEY_getWIFPrivateKey(KEY_MASTER), seed2WIFPrivateKey) ||
+                0 != strcmp(KEY_getBtcAddr(KEY_MASTER), seed2BtcAddr)) {
+            NRF_LOG_ERROR("Key file test, layout %d master mismatched", layouts[i]);
+            return (3);
+        }
+        /* Encoded strings are kept, asking again must give the same. */
+        if (0 != strcmp(KEY_getExtPublicKey(KEY_MASTER), seed2ExtPublicKey) ||
+                0 != strcmp(KEY_getBtcAddr(KEY_MASTER), seed2BtcAddr)) {
+            NRF_LOG_ERROR("Key file test, layout %d cached string mismatched", layouts[i]);
+            return (4);
+        }
+        if (0 != memcmp(KEY_getPublicKey(KEY_DERIVATIVE), &keyObj.slots[0].derivative.publicKey, sizeof(CRYPTO_publicKey)) ||
+                0 != memcmp(KEY_getHash160(KEY_DERIVATIVE), &keyObj.slots[0].derivative.hash160, sizeof(CRYPTO_hash160)) ||
+                0 != strcmp(KEY_getExtPublicKey(KEY_DERIVATIVE), extPublicKey.str_ptr) ||
+                0 != memcmp(KEY_getDerivativePath(), &keyObj.slots[0].path, sizeof(CRYPTO_derivativePath))) {
+            NRF_LOG_ERROR("Key file test, layout %d derivative mismatched", layouts[i]);
+            return (5);
+        }
+        if (KEY_getPin() != keyObj.pin || KEY_getPinAuthFailures() != keyObj.pin_auth_failures ||
+                KEY_getPinAuthRetryAfter() != keyObj.pin_retry_after || 0 != strcmp(KEY_getNote(), keyObj.keyNote)) {
+            NRF_LOG_ERROR("Key file test, layout %d settings mismatched", layouts[i]);
+            return (6);
+        }
+    }
+
+    if (KEY_init() != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Key file test, reload device keys failed");
+        return (7);
+    }
+
+    return (0);
+}
+
+/*
+ * ======== keySlotTests() ========
+ * Every slot must present its own derivative key, path and encoded strings, switching slots back
+ * and forth. Out of range slot must be rejected, keeping the selected one.
+ * Device keys are loaded again at the end.
+ */
+int keySlotTests(void)
+{
+    static KEY_Object keyObj;
+    static CRYPTO_extPublicKey extPublicKeys[KEY_SLOT_COUNT];
+    bool isLegacy;
+    int round;
+    int i;
+
+    memset(&keyObj, 0, sizeof(keyObj));
+    if (CRYPTO_deriveHdNode(NULL, &keyObj.master, NULL, &seed2) != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Key slot test, derive master failed");
+        return (1);
+    }
+    for (i = 0; i < KEY_SLOT_COUNT; i++) {
+        CRYPTO_setDerivativePath(&keyObj.slots[i].path, CRYPTO_DERIVATIVE_DEPTH - 1, i);
+        if (CRYPTO_deriveHdNode(&keyObj.master, &keyObj.slots[i].derivative, &keyObj.slots[i].path, NULL) != OTK_RETURN_OK ||
+                CRYPTO_encodeExtPublicKey(&keyObj.slots[i].derivative, &extPublicKeys[i]) != OTK_RETURN_OK) {
+            NRF_LOG_ERROR("Key slot test, derive slot %d failed", i);
+            return (1);
+        }
+    }
+
+    if (KEY_restoreLayout(KEY_FILE_CURRENT, &keyObj, &isLegacy) != OTK_RETURN_OK || KEY_getSlot() != 0) {
+        NRF_LOG_ERROR("Key slot test, restore failed");
+        return (2);
+    }
+    for (round = 0; round < 2; round++) {
+        for (i = KEY_SLOT_COUNT - 1; i >= 0; i--) {
+            if (KEY_selectSlot(i) != OTK_RETURN_OK || KEY_getSlot() != i) {
+                NRF_LOG_ERROR("Key slot test, select slot %d failed", i);
+                return (3);
+            }
+            if (0 != memcmp(KEY_getPublicKey(KEY_DERIVATIVE), &keyObj.slots[i].derivative.publicKey, sizeof(CRYPTO_publicKey)) ||
+                    0 != memcmp(KEY_getDerivativePath(), &keyObj.slots[i].path, sizeof(CRYPTO_derivativePath)) ||
+                    0 != strcmp(KEY_getExtPublicKey(KEY_DERIVATIVE), extPublicKeys[i].str_ptr) ||
+                    0 != strcmp(KEY_getExtPublicKey(KEY_MASTER), seed2ExtPublicKey)) {
+                NRF_LOG_ERROR("Key slot test, slot %d mismatched", i);
+                return (4);
+            }
+        }
+    }
+    if (KEY_selectSlot(KEY_SLOT_COUNT) == OTK_RETURN_OK || KEY_getSlot() != 0) {
+        NRF_LOG_ERROR("Key slot test, out of range slot accepted");
+        return (5);
+    }
+
+    if (KEY_init() != OTK_RETURN_OK) {
+        NRF_LOG_ERROR("Key slot test, reload device keys failed");
+        return (6);
+    }
+
+    return (0);
+}
+
+/* Commands executed by nfcBatchTests, in order. */
+static NFC_REQUEST_COMMAND batchCommands[NFC_BATCH_MAX];
+static char batchData[NFC_BATCH_MAX][16];
+static char batchOptions[NFC_BATCH_MAX][16];
+static int batchExecCount;
+static int batchFailAt;
+
+static NFC_COMMAND_EXEC_STATE unittest_batchExec(NFC_REQUEST_COMMAND command, const char *data_ptr, const char *opt_ptr)
+{
+    if (batchExecCount < NFC_BATCH_MAX) {
+        batchCommands[batchExecCount] = command;
+        strncpy(batchData[batchExecCount], data_ptr, sizeof(batchData[0]) - 1);
+        strncpy(batchOptions[batchExecCount], opt_ptr, sizeof(batchOptions[0]) - 1);
+    }
+    return ((batchExecCount++ == batchFailAt) ? NFC_CMD_EXEC_FAIL : NFC_CMD_EXEC_SUCCESS);
+}
+
+/* Run a batch, return number of batched commands and count command states in session data. */
+static int unittest_runBatch(NFC_REQUEST_COMMAND command, char *records[], int recordCount, int failAt, int *stateCount_ptr)
+{
+    static char sessData[NFC_REQUEST_DATA_BUF_SZ];
+    char *pos_ptr = sessData;
+    int ret;
+
+    memset(batchCommands, 0, sizeof(batchCommands));
+    memset(batchData, 0, sizeof(batchData));
+    memset(batchOptions, 0, sizeof(batchOptions));
+    batchExecCount = 0;
+    batchFailAt = failAt;
+
+    ret = NFC_runBatch(command, records, recordCount, unittest_batchExec, sessData, sizeof(sessData));
+    for (*stateCount_ptr = 0; (pos_ptr = strstr(pos_ptr, "<" OTK_LABEL_COMMAND_STATE ">")) != NULL; pos_ptr++) {
+        (*stateCount_ptr)++;
+    }
+    return (ret);
+}
+
+/*
+ * ======== nfcBatchTests() ========
+ * Batched commands must be executed in order with their own data and option, missing data and
+ * option of the last command are empty, and the batch must stop at the first failed command.
+ * Each executed command must present its state. Commands which cannot be batched, Export WIF Key
+ * included, too many commands and a batched command changing response format must be rejected
+ * without executing anything.
+ */
+int nfcBatchTests(void)
+{
+    /* Set PIN 1234, set key path of slot 1, set note "batch", following the first Set Note. */
+    char *records[] = {"165", "1234", "", "164", "0,0,0,0,1", "slot=1", "166", "batch"};
+    char *wifRecords[] = {"169", "", ""};
+    char *lockRecords[] = {"160", "", ""};
+    char *tooManyRecords[] = {"166", "a", "", "166", "b", "", "166", "c", "", "166", "d", ""};
+    /* The first command takes text response, a batched command may repeat it but not change it. */
+    char *textRecords[] = {"162", "", "key=1,bin=0"};
+    char *binRecords[] = {"162", "", "key=1,bin=1"};
+    int recordCount = sizeof(records) / sizeof(records[0]);
+    int stateCount;
+
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, records, recordCount, -1, &stateCount) != 3 ||
+            batchExecCount != 4 || stateCount != 4 ||
+            batchCommands[0] != NFC_REQUEST_CMD_SET_NOTE || batchCommands[1] != NFC_REQUEST_CMD_SET_PIN ||
+            batchCommands[2] != NFC_REQUEST_CMD_SET_KEY || batchCommands[3] != NFC_REQUEST_CMD_SET_NOTE) {
+        NRF_LOG_ERROR("Batch test, execution order mismatched");
+        return (1);
+    }
+    if (0 != strcmp(batchData[1], "1234") || 0 != strcmp(batchOptions[1], "") ||
+            0 != strcmp(batchData[2], "0,0,0,0,1") || 0 != strcmp(batchOptions[2], "slot=1") ||
+            0 != strcmp(batchData[3], "batch") || 0 != strcmp(batchOptions[3], "")) {
+        NRF_LOG_ERROR("Batch test, data or option mismatched");
+        return (2);
+    }
+
+    /* The second command fails, the third and fourth are not executed. */
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, records, recordCount, 1, &stateCount) != 3 ||
+            batchExecCount != 2 || stateCount != 2) {
+        NRF_LOG_ERROR("Batch test, batch not stopped at failure");
+        return (3);
+    }
+    /* The first command fails, nothing batched is executed. */
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, records, recordCount, 0, &stateCount) != 3 ||
+            batchExecCount != 1 || stateCount != 1) {
+        NRF_LOG_ERROR("Batch test, batch not stopped at first failure");
+        return (4);
+    }
+    /* A single command presents no command state. */
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, records, 0, -1, &stateCount) != 0 ||
+            batchExecCount != 1 || stateCount != 0) {
+        NRF_LOG_ERROR("Batch test, single command mismatched");
+        return (5);
+    }
+
+    if (unittest_runBatch(NFC_REQUEST_CMD_SHOW_KEY, wifRecords, 3, -1, &stateCount) != -1 || batchExecCount != 0) {
+        NRF_LOG_ERROR("Batch test, batched Export WIF Key accepted");
+        return (6);
+    }
+    if (unittest_runBatch(NFC_REQUEST_CMD_EXPORT_WIF_KEY, records, recordCount, -1, &stateCount) != -1 || batchExecCount != 0) {
+        NRF_LOG_ERROR("Batch test, Export WIF Key leading a batch accepted");
+        return (7);
+    }
+    if (unittest_runBatch(NFC_REQUEST_CMD_SHOW_KEY, lockRecords, 3, -1, &stateCount) != -1 || batchExecCount != 0) {
+        NRF_LOG_ERROR("Batch test, batched Lock accepted");
+        return (8);
+    }
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, tooManyRecords, 12, -1, &stateCount) != -1 || batchExecCount != 0) {
+        NRF_LOG_ERROR("Batch test, too many commands accepted");
+        return (9);
+    }
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, textRecords, 3, -1, &stateCount) != 1 || batchExecCount != 2) {
+        NRF_LOG_ERROR("Batch test, repeated response format rejected");
+        return (10);
+    }
+    if (unittest_runBatch(NFC_REQUEST_CMD_SET_NOTE, binRecords, 3, -1, &stateCount) != -1 || batchExecCount != 0) {
+        NRF_LOG_ERROR("Batch test, changed response format accepted");
+        return (11);
+    }
+
+    return (0);
+}
+#endif /* (UNITTEST) */
+
 /*
  *
  */
 int unittestRun(void)
 {
-    return(hdTests());
+    int ret;
+
+    if ((ret = hdTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = hdCacheTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = pubKeyTests()) != 0) {
+        return (ret);
+    }
+#if (UNITTEST)
+    if ((ret = keyFileTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = keySlotTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = nfcBatchTests()) != 0) {
+        return (ret);
+    }
+#endif
+    if ((ret = signTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = verifyCacheTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = verifyTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = signBatchTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = hash160Tests()) != 0) {
+        return (ret);
+    }
+    if ((ret = schnorrTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = recoverTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = strWriterTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = hashWriterTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = hmacTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = sha512Tests()) != 0) {
+        return (ret);
+    }
+    if ((ret = sha256Tests()) != 0) {
+        return (ret);
+    }
+    if ((ret = hashProviderTests()) != 0) {
+        return (ret);
+    }
+    if ((ret = base58Tests()) != 0) {
+        return (ret);
+    }
+    if ((ret = hexTests()) != 0) {
+        return (ret);
+    }
+    return (sighashTests());
 }
 